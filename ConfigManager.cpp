@@ -1,7 +1,46 @@
 #include "ConfigManager.h"
+#include "PoseTopology.h"
 #include <iomanip>
 
+namespace {
+    // 노드가 존재할 때만 값을 읽음 (없으면 기본값 유지)
+    template <typename T>
+    void readOptional(const cv::FileNode& node, T& value) {
+        if (!node.empty()) {
+            node >> value;
+        }
+    }
+
+    // 스레드 역할 설정 읽기
+    void readThreadConfig(const cv::FileNode& node, AppConfig::ThreadConfig& thread) {
+        readOptional(node["cpus"], thread.cpus);
+        readOptional(node["priority"], thread.priority);
+    }
+
+    std::string describeThreadConfig(const AppConfig::ThreadConfig& thread) {
+        std::string text = thread.cpus.empty() ? "CPU 고정 없음" : "CPU " + thread.cpus;
+        if (thread.priority > 0) {
+            text += ", SCHED_FIFO " + std::to_string(thread.priority);
+        }
+        return text;
+    }
+
+    // 해상도 프로파일 목록이 같은지 (순서 포함)
+    bool sameProfiles(const std::vector<AppConfig::InputProfile>& a, const std::vector<AppConfig::InputProfile>& b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); i++) {
+            if (a[i].width != b[i].width || a[i].height != b[i].height || a[i].model_path != b[i].model_path) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
 bool ConfigManager::loadConfig(const std::string& config_file, AppConfig& config) {
+    // 설정 파일에 없는 선택 항목은 기본값 사용
+    setDefaultConfig(config);
+
     try {
         cv::FileStorage fs(config_file, cv::FileStorage::READ);
         if (!fs.isOpened()) {
@@ -27,15 +66,34 @@ bool ConfigManager::loadConfig(const std::string& config_file, AppConfig& config
         fs["depth_range"]["max"] >> config.depth_range.max;
 
         fs["save"]["directory"] >> config.save.directory;
+        readOptional(fs["save"]["session"], config.save.session);
+        readOptional(fs["save"]["shard_size"], config.save.shard_size);
         
         // Pose 설정 로드
+        readOptional(fs["pose"]["backend"], config.pose.backend);
         fs["pose"]["model_path"] >> config.pose.model_path;
+        readOptional(fs["pose"]["topology"], config.pose.topology);
         fs["pose"]["use_cuda"] >> config.pose.use_cuda;
         fs["pose"]["confidence_threshold"] >> config.pose.confidence_threshold;
         fs["pose"]["input_width"] >> config.pose.input_width;
         fs["pose"]["input_height"] >> config.pose.input_height;
         fs["pose"]["heatmap_width"] >> config.pose.heatmap_width;
         fs["pose"]["heatmap_height"] >> config.pose.heatmap_height;
+        readOptional(fs["pose"]["postprocess_threads"], config.pose.postprocess_threads);
+
+        cv::FileNode profilesNode = fs["pose"]["profiles"];
+        if (profilesNode.isSeq()) {
+            config.pose.profiles.clear();
+            for (cv::FileNodeIterator it = profilesNode.begin(); it != profilesNode.end(); ++it) {
+                AppConfig::InputProfile profile;
+                profile.width = 0;
+                profile.height = 0;
+                readOptional((*it)["width"], profile.width);
+                readOptional((*it)["height"], profile.height);
+                readOptional((*it)["model_path"], profile.model_path);
+                config.pose.profiles.push_back(profile);
+            }
+        }
         // 벡터 읽기
         cv::FileNode meanNode = fs["pose"]["preprocess"]["mean"];
         if (meanNode.isSeq()) {
@@ -46,6 +104,104 @@ bool ConfigManager::loadConfig(const std::string& config_file, AppConfig& config
             stdNode >> config.pose.std;
         }
 
+        readOptional(fs["capture"]["mode"], config.capture.mode);
+        readOptional(fs["capture"]["timeout_ms"], config.capture.timeout_ms);
+
+        // 다중 카메라 장치 목록
+        cv::FileNode camerasNode = fs["cameras"];
+        if (camerasNode.isSeq()) {
+            config.cameras.clear();
+            for (cv::FileNodeIterator it = camerasNode.begin(); it != camerasNode.end(); ++it) {
+                AppConfig::CameraConfig camera;
+                camera.sync_mode = 0;
+                readOptional((*it)["serial"], camera.serial);
+                readOptional((*it)["playback_file"], camera.playback_file);
+                readOptional((*it)["sync_mode"], camera.sync_mode);
+                config.cameras.push_back(camera);
+            }
+        }
+        readOptional(fs["multi_camera"]["group_tolerance_ms"], config.multi_camera.group_tolerance_ms);
+
+        // 실행 모드 / 키포인트 전송 설정 로드 (없으면 기본값 유지)
+        readOptional(fs["runtime"]["headless"], config.runtime.headless);
+        readOptional(fs["runtime"]["status_interval_sec"], config.runtime.status_interval_sec);
+        readOptional(fs["runtime"]["hot_reload"], config.runtime.hot_reload);
+        readOptional(fs["display"]["max_fps"], config.display.max_fps);
+        readOptional(fs["display"]["composite"], config.display.composite);
+
+        readOptional(fs["record"]["enabled"], config.record.enabled);
+        readOptional(fs["record"]["directory"], config.record.directory);
+        readOptional(fs["record"]["codec"], config.record.codec);
+        readOptional(fs["record"]["fps"], config.record.fps);
+        readOptional(fs["record"]["segment_seconds"], config.record.segment_seconds);
+        readOptional(fs["record"]["segment_mb"], config.record.segment_mb);
+        readOptional(fs["record"]["queue_size"], config.record.queue_size);
+        readOptional(fs["record"]["depth"], config.record.depth);
+
+        readOptional(fs["publish"]["enabled"], config.publish.enabled);
+        readOptional(fs["publish"]["socket_path"], config.publish.socket_path);
+        readOptional(fs["publish"]["include_3d"], config.publish.include_3d);
+
+        readOptional(fs["shared_memory"]["enabled"], config.shared_memory.enabled);
+        readOptional(fs["shared_memory"]["name"], config.shared_memory.name);
+        readOptional(fs["shared_memory"]["slots"], config.shared_memory.slots);
+        readOptional(fs["shared_memory"]["max_persons"], config.shared_memory.max_persons);
+
+        readOptional(fs["metrics"]["enabled"], config.metrics.enabled);
+        readOptional(fs["metrics"]["bind_address"], config.metrics.bind_address);
+        readOptional(fs["metrics"]["port"], config.metrics.port);
+
+        readOptional(fs["latency"]["log_enabled"], config.latency.log_enabled);
+        readOptional(fs["latency"]["log_path"], config.latency.log_path);
+        readOptional(fs["latency"]["log_format"], config.latency.log_format);
+
+        readOptional(fs["presence"]["enabled"], config.presence.enabled);
+        readOptional(fs["presence"]["decimation"], config.presence.decimation);
+        readOptional(fs["presence"]["foreground_threshold_mm"], config.presence.foreground_threshold_mm);
+        readOptional(fs["presence"]["foreground_ratio"], config.presence.foreground_ratio);
+        readOptional(fs["presence"]["motion_threshold_mm"], config.presence.motion_threshold_mm);
+        readOptional(fs["presence"]["motion_ratio"], config.presence.motion_ratio);
+        readOptional(fs["presence"]["background_alpha"], config.presence.background_alpha);
+        readOptional(fs["presence"]["hold_ms"], config.presence.hold_ms);
+        readOptional(fs["presence"]["heartbeat_ms"], config.presence.heartbeat_ms);
+        readOptional(fs["presence"]["min_keypoints"], config.presence.min_keypoints);
+        readOptional(fs["presence"]["absorb_ms"], config.presence.absorb_ms);
+
+        readOptional(fs["pointcloud"]["save_ply"], config.pointcloud.save_ply);
+        readOptional(fs["pointcloud"]["voxel_size"], config.pointcloud.voxel_size);
+        readOptional(fs["pointcloud"]["hull_margin"], config.pointcloud.hull_margin);
+        readOptional(fs["pointcloud"]["depth_band"], config.pointcloud.depth_band);
+
+        readOptional(fs["governor"]["enabled"], config.governor.enabled);
+        readOptional(fs["governor"]["target_frame_ms"], config.governor.target_frame_ms);
+        readOptional(fs["governor"]["window"], config.governor.window);
+        readOptional(fs["governor"]["step_down_ratio"], config.governor.step_down_ratio);
+        readOptional(fs["governor"]["step_up_ratio"], config.governor.step_up_ratio);
+        readOptional(fs["governor"]["cooldown_frames"], config.governor.cooldown_frames);
+        readThreadConfig(fs["threads"]["capture"], config.threads.capture);
+        readThreadConfig(fs["threads"]["processing"], config.threads.processing);
+        readThreadConfig(fs["threads"]["postprocess"], config.threads.postprocess);
+        readOptional(fs["threads"]["lock_memory"], config.threads.lock_memory);
+
+        cv::FileNode levelsNode = fs["governor"]["levels"];
+        if (levelsNode.isSeq()) {
+            config.governor.levels.clear();
+            for (cv::FileNodeIterator it = levelsNode.begin(); it != levelsNode.end(); ++it) {
+                AppConfig::GovernorLevel level;
+                level.input_width = config.pose.input_width;
+                level.input_height = config.pose.input_height;
+                level.depth_visualization = true;
+                level.inference_interval = 1;
+                level.depth_decimation = 1;
+                readOptional((*it)["input_width"], level.input_width);
+                readOptional((*it)["input_height"], level.input_height);
+                readOptional((*it)["depth_visualization"], level.depth_visualization);
+                readOptional((*it)["inference_interval"], level.inference_interval);
+                readOptional((*it)["depth_decimation"], level.depth_decimation);
+                config.governor.levels.push_back(level);
+            }
+        }
+
         fs.release();
         return true;
     }
@@ -75,17 +231,102 @@ void ConfigManager::setDefaultConfig(AppConfig& config) {
     config.depth_range.max = 1.0f;
     
     config.save.directory = "./results/";
+    config.save.session = "";
+    config.save.shard_size = 1000;
     
     // Pose 기본 설정
+    config.pose.backend = "tensorrt";
     config.pose.model_path = "./trt/higher_hrnet.trt"; // 기본 경로
+    config.pose.topology = "coco17";
     config.pose.use_cuda = true; // 기본값은 CUDA 사용
     config.pose.confidence_threshold = 0.3f;
     config.pose.input_width = 512;
     config.pose.input_height = 512;
     config.pose.heatmap_width = 128;
     config.pose.heatmap_height = 128;
+    config.pose.postprocess_threads = 1;
+    config.pose.profiles.clear();
     config.pose.mean = {0.485f, 0.456f, 0.406f};
     config.pose.std = {0.229f, 0.224f, 0.225f};
+
+    // 캡처 모드 기본값
+    config.capture.mode = "wait";
+    config.capture.timeout_ms = 5000;
+
+    // 다중 카메라 기본값 (단일 카메라)
+    config.cameras.clear();
+    config.multi_camera.group_tolerance_ms = 20.0;
+
+    // 실행 모드 기본값
+    config.runtime.headless = false;
+    config.runtime.status_interval_sec = 5;
+    config.runtime.hot_reload = true;
+    config.display.max_fps = 30.0;
+    config.display.composite = false;
+
+    // 동영상 녹화 기본값
+    config.record.enabled = false;
+    config.record.directory = "recordings";
+    config.record.codec = "mp4v";
+    config.record.fps = 15.0;
+    config.record.segment_seconds = 300;
+    config.record.segment_mb = 1024;
+    config.record.queue_size = 8;
+    config.record.depth = true;
+
+    // 키포인트 전송 기본값
+    config.publish.enabled = false;
+    config.publish.socket_path = "/tmp/realposesense.sock";
+    config.publish.include_3d = true;
+
+    // 공유 메모리 링 기본값
+    config.shared_memory.enabled = false;
+    config.shared_memory.name = "/realposesense";
+    config.shared_memory.slots = 8;
+    config.shared_memory.max_persons = 8;
+
+    // 메트릭 엔드포인트 기본값
+    config.metrics.enabled = false;
+    config.metrics.bind_address = "127.0.0.1";
+    config.metrics.port = 9464;
+
+    // 지연 로그 기본값
+    config.latency.log_enabled = false;
+    config.latency.log_path = "./latency.csv";
+    config.latency.log_format = "csv";
+
+    // 재실 게이트 기본값
+    config.presence.enabled = false;
+    config.presence.decimation = 8;
+    config.presence.foreground_threshold_mm = 150.0f;
+    config.presence.foreground_ratio = 0.02f;
+    config.presence.motion_threshold_mm = 50.0f;
+    config.presence.motion_ratio = 0.01f;
+    config.presence.background_alpha = 0.02f;
+    config.presence.hold_ms = 3000;
+    config.presence.heartbeat_ms = 1000;
+    config.presence.min_keypoints = 5;
+    config.presence.absorb_ms = 10000;
+
+    config.pointcloud.save_ply = false;
+    config.pointcloud.voxel_size = 0.01f;
+    config.pointcloud.hull_margin = 0.15f;
+    config.pointcloud.depth_band = 0.6f;
+
+    // 품질 조절기 기본값 (단계 목록은 비워 두면 실행 시 생성)
+    config.governor.enabled = false;
+    config.governor.target_frame_ms = 50.0;
+    config.governor.window = 30;
+    config.governor.step_down_ratio = 1.1;
+    config.governor.step_up_ratio = 0.7;
+    config.governor.cooldown_frames = 60;
+    config.governor.levels.clear();
+
+    // 스레드 고정 기본값 (운영체제 스케줄러에 맡김)
+    config.threads.capture = AppConfig::ThreadConfig{"", 0};
+    config.threads.processing = AppConfig::ThreadConfig{"", 0};
+    config.threads.postprocess = AppConfig::ThreadConfig{"", 0};
+    config.threads.lock_memory = false;
 }
 
 void ConfigManager::printConfig(const AppConfig& config) {
@@ -103,23 +344,183 @@ void ConfigManager::printConfig(const AppConfig& config) {
     std::cout << "  - 깊이 스트림: " << config.stream.depth.width << "x" << config.stream.depth.height 
               << ", 포맷: " << config.stream.depth.format << ", FPS: " << config.stream.depth.fps << std::endl;
     
+    std::cout << "[캡처 설정]" << std::endl;
+    std::cout << "  - 모드: " << config.capture.mode
+              << (config.capture.mode == "latest" ? " (최신 프레임만, 이전 프레임은 버림)" : " (모든 프레임 순서대로)") << std::endl;
+    std::cout << "  - 대기 시간 제한: " << config.capture.timeout_ms << "ms" << std::endl;
+    
+    if (!config.cameras.empty()) {
+        std::cout << "[카메라 장치 설정]" << std::endl;
+        for (size_t i = 0; i < config.cameras.size(); i++) {
+            const AppConfig::CameraConfig& camera = config.cameras[i];
+            std::cout << "  - 카메라 " << i << ": ";
+            if (!camera.playback_file.empty()) {
+                std::cout << "재생 파일 " << camera.playback_file;
+            } else {
+                std::cout << "시리얼 " << (camera.serial.empty() ? "(자동)" : camera.serial);
+            }
+            std::cout << ", 동기화 모드: " << camera.sync_mode << std::endl;
+        }
+        std::cout << "  - 프레임 묶음 허용 오차: " << config.multi_camera.group_tolerance_ms << "ms" << std::endl;
+    }
+    
     std::cout << "[깊이 범위 설정]" << std::endl;
     std::cout << "  - 최소 깊이: " << config.depth_range.min << "m" << std::endl;
     std::cout << "  - 최대 깊이: " << config.depth_range.max << "m" << std::endl;
     
     std::cout << "[저장 설정]" << std::endl;
     std::cout << "  - 저장 디렉토리: " << config.save.directory << std::endl;
+    std::cout << "  - 세션: " << (config.save.session.empty() ? "새 세션" : config.save.session)
+              << ", 샤드 크기: " << config.save.shard_size << std::endl;
     
     std::cout << "[포즈 추정 설정]" << std::endl;
+    std::cout << "  - 백엔드: " << config.pose.backend << std::endl;
     std::cout << "  - 모델 경로: " << config.pose.model_path << std::endl;
+    std::cout << "  - 관절 구성: " << config.pose.topology << std::endl;
     std::cout << "  - CUDA 사용: " << (config.pose.use_cuda ? "True" : "False") << std::endl;
     std::cout << "  - 신뢰도 임계값: " << config.pose.confidence_threshold << std::endl;
     std::cout << "  - 입력 크기: " << config.pose.input_width << "x" << config.pose.input_height << std::endl;
     std::cout << "  - 히트맵 크기: " << config.pose.heatmap_width << "x" << config.pose.heatmap_height << std::endl;
+    std::cout << "  - 후처리 스레드: " << config.pose.postprocess_threads << std::endl;
+    for (size_t i = 0; i < config.pose.profiles.size(); i++) {
+        const AppConfig::InputProfile& profile = config.pose.profiles[i];
+        std::cout << "  - 해상도 프로파일 " << i << ": " << profile.width << "x" << profile.height
+                  << (profile.model_path.empty() ? "" : " (" + profile.model_path + ")") << std::endl;
+    }
     std::cout << "  - 정규화 평균 (RGB): [" 
               << config.pose.mean[0] << ", " << config.pose.mean[1] << ", " << config.pose.mean[2] << "]" << std::endl;
     std::cout << "  - 정규화 표준편차 (RGB): [" 
               << config.pose.std[0] << ", " << config.pose.std[1] << ", " << config.pose.std[2] << "]" << std::endl;
 
+    std::cout << "[실행 모드 설정]" << std::endl;
+    std::cout << "  - 헤드리스 모드: " << (config.runtime.headless ? "True" : "False") << std::endl;
+    std::cout << "  - 상태 로그 주기: " << config.runtime.status_interval_sec << "초" << std::endl;
+    std::cout << "  - 설정 핫 리로드: " << (config.runtime.hot_reload ? "True" : "False") << std::endl;
+    std::cout << "  - 화면 갱신 상한: " << config.display.max_fps << " FPS"
+              << (config.display.composite ? " (단일 창)" : "") << std::endl;
+
+    std::cout << "[동영상 녹화 설정]" << std::endl;
+    std::cout << "  - 사용: " << (config.record.enabled ? "True" : "False") << std::endl;
+    if (config.record.enabled) {
+        std::cout << "  - 디렉토리: " << config.record.directory << ", 코덱: " << config.record.codec
+                  << ", " << config.record.fps << " FPS" << (config.record.depth ? " (깊이 포함)" : "") << std::endl;
+        std::cout << "  - 세그먼트: " << config.record.segment_seconds << "초 / " << config.record.segment_mb
+                  << "MB, 큐: " << config.record.queue_size << "프레임" << std::endl;
+    }
+
+    std::cout << "[키포인트 전송 설정]" << std::endl;
+    std::cout << "  - 사용: " << (config.publish.enabled ? "True" : "False") << std::endl;
+    std::cout << "  - 소켓 경로: " << config.publish.socket_path << std::endl;
+    std::cout << "  - 3D 포함: " << (config.publish.include_3d ? "True" : "False") << std::endl;
+
+    std::cout << "[공유 메모리 링 설정]" << std::endl;
+    std::cout << "  - 사용: " << (config.shared_memory.enabled ? "True" : "False") << std::endl;
+    std::cout << "  - 이름: " << config.shared_memory.name << ", 슬롯: " << config.shared_memory.slots
+              << ", 최대 인원: " << config.shared_memory.max_persons << std::endl;
+
+    std::cout << "[메트릭 설정]" << std::endl;
+    std::cout << "  - 사용: " << (config.metrics.enabled ? "True" : "False") << std::endl;
+    std::cout << "  - 주소: " << config.metrics.bind_address << ":" << config.metrics.port << std::endl;
+
+    std::cout << "[지연 로그 설정]" << std::endl;
+    std::cout << "  - 사용: " << (config.latency.log_enabled ? "True" : "False") << std::endl;
+    std::cout << "  - 경로: " << config.latency.log_path << " (" << config.latency.log_format << ")" << std::endl;
+
+    std::cout << "[재실 게이트 설정]" << std::endl;
+    std::cout << "  - 사용: " << (config.presence.enabled ? "True" : "False") << std::endl;
+    std::cout << "  - 샘플링 간격: " << config.presence.decimation << "px, 전경 " << config.presence.foreground_threshold_mm
+              << "mm/" << config.presence.foreground_ratio * 100.0f << "%, 움직임 " << config.presence.motion_threshold_mm
+              << "mm/" << config.presence.motion_ratio * 100.0f << "%" << std::endl;
+    std::cout << "  - 유지: " << config.presence.hold_ms << "ms, 하트비트: " << config.presence.heartbeat_ms
+              << "ms, 배경 흡수: " << config.presence.absorb_ms << "ms" << std::endl;
+
+    std::cout << "[점군 설정]" << std::endl;
+    std::cout << "  - 저장 시 PLY: " << (config.pointcloud.save_ply ? "True" : "False") << std::endl;
+    std::cout << "  - 복셀: " << config.pointcloud.voxel_size << "m, 껍질 확장: " << config.pointcloud.hull_margin * 100.0f
+              << "%, 깊이 범위: ±" << config.pointcloud.depth_band << "m" << std::endl;
+
+    std::cout << "[품질 조절기 설정]" << std::endl;
+    std::cout << "  - 사용: " << (config.governor.enabled ? "True" : "False") << std::endl;
+    std::cout << "  - 목표 프레임 시간: " << config.governor.target_frame_ms << "ms (최근 " << config.governor.window << "프레임 평균)" << std::endl;
+    std::cout << "  - 단계 수: " << (config.governor.levels.empty() ? std::string("기본") : std::to_string(config.governor.levels.size())) << std::endl;
+
+    std::cout << "[스레드 설정]" << std::endl;
+    std::cout << "  - 캡처: " << describeThreadConfig(config.threads.capture) << std::endl;
+    std::cout << "  - 처리: " << describeThreadConfig(config.threads.processing) << std::endl;
+    std::cout << "  - 후처리: " << describeThreadConfig(config.threads.postprocess) << std::endl;
+    std::cout << "  - 메모리 고정: " << (config.threads.lock_memory ? "True" : "False") << std::endl;
+
     std::cout << "======================" << std::endl;
-} 
\ No newline at end of file
+}
+
+bool ConfigManager::validateConfig(const AppConfig& config) {
+    bool valid = true;
+    auto fail = [&valid](const std::string& message) {
+        std::cerr << "[설정 오류] " << message << std::endl;
+        valid = false;
+    };
+
+    if (config.depth_range.min < 0.0f || config.depth_range.min >= config.depth_range.max) {
+        fail("depth_range: 0 <= min < max 이어야 합니다");
+    }
+    if (config.visualization.clahe.clip_limit <= 0.0 || config.visualization.clahe.tile_grid_size <= 0) {
+        fail("visualization.clahe: clip_limit와 tile_grid_size는 0보다 커야 합니다");
+    }
+    if (config.save.directory.empty() || config.save.shard_size <= 0) {
+        fail("save: directory가 비어 있지 않고 shard_size가 0보다 커야 합니다");
+    }
+    if (config.pose.backend != "tensorrt" && config.pose.backend != "opencv") {
+        fail("pose.backend: \"tensorrt\" 또는 \"opencv\"여야 합니다");
+    }
+    if (config.pose.model_path.empty()) {
+        fail("pose.model_path가 비어 있습니다");
+    }
+    int topologyJoints = 0;
+    if (!PoseTopology::visit(config.pose.topology, [&topologyJoints](auto topology) {
+            topologyJoints = decltype(topology)::kNumJoints;
+        })) {
+        fail("pose.topology: \"coco17\", \"wholebody133\", \"hand21\" 중 하나여야 합니다");
+    } else if (topologyJoints > PoseResult::kMaxKeypoints) {
+        fail("pose.topology: " + config.pose.topology + "는 관절 " + std::to_string(topologyJoints) +
+             "개 - POSE_MAX_KEYPOINTS=" + std::to_string(topologyJoints) + " 이상으로 다시 빌드해야 합니다");
+    }
+    if (config.pose.confidence_threshold < 0.0f || config.pose.confidence_threshold > 1.0f) {
+        fail("pose.confidence_threshold: 0 ~ 1 범위여야 합니다");
+    }
+    if (config.pose.input_width <= 0 || config.pose.input_height <= 0 ||
+        config.pose.heatmap_width <= 0 || config.pose.heatmap_height <= 0) {
+        fail("pose: 입력/히트맵 크기는 0보다 커야 합니다");
+    }
+    if (config.pose.mean.size() != 3 || config.pose.std.size() != 3) {
+        fail("pose.preprocess: mean과 std는 값 3개 [R, G, B]여야 합니다");
+    }
+    if (config.pose.postprocess_threads < 1) {
+        fail("pose.postprocess_threads는 1 이상이어야 합니다");
+    }
+    for (const AppConfig::InputProfile& profile : config.pose.profiles) {
+        if (profile.width <= 0 || profile.height <= 0) {
+            fail("pose.profiles: width와 height는 0보다 커야 합니다");
+        }
+    }
+    if (config.governor.window <= 0 || config.governor.cooldown_frames < 0) {
+        fail("governor: window는 1 이상, cooldown_frames는 0 이상이어야 합니다");
+    }
+    for (const AppConfig::GovernorLevel& level : config.governor.levels) {
+        if (level.inference_interval < 1 || level.depth_decimation < 1) {
+            fail("governor.levels: inference_interval과 depth_decimation은 1 이상이어야 합니다");
+        }
+    }
+    return valid;
+}
+
+bool ConfigManager::modelChanged(const AppConfig& before, const AppConfig& after) {
+    const AppConfig::PoseConfig& a = before.pose;
+    const AppConfig::PoseConfig& b = after.pose;
+    return a.backend != b.backend || a.model_path != b.model_path || a.topology != b.topology || a.use_cuda != b.use_cuda ||
+           a.input_width != b.input_width || a.input_height != b.input_height ||
+           a.heatmap_width != b.heatmap_width || a.heatmap_height != b.heatmap_height ||
+           a.postprocess_threads != b.postprocess_threads ||
+           !sameProfiles(a.profiles, b.profiles) ||
+           before.threads.postprocess.cpus != after.threads.postprocess.cpus ||
+           before.threads.postprocess.priority != after.threads.postprocess.priority;
+}
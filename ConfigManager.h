@@ -23,6 +23,11 @@ struct AppConfig {
             int fps;
         } color, depth;
     } stream;
+
+    struct {
+        std::string mode; // "wait": wait_for_frames (모든 프레임 처리), "latest": 최신 프레임만 (저지연)
+        int timeout_ms;   // 프레임 대기 최대 시간
+    } capture;
     
     struct {
         float min;
@@ -31,19 +36,144 @@ struct AppConfig {
     
     struct {
         std::string directory;
+        std::string session; // 이어서 저장할 세션 디렉토리 이름 (비어 있으면 실행마다 새 세션)
+        int shard_size;      // 샤드 디렉토리 하나에 넣을 캡처 수
     } save;
 
+    // 포즈 모델 입력 해상도 프로파일 (모델 재로드 없이 detect 호출마다 선택)
+    struct InputProfile {
+        int width;
+        int height;
+        std::string model_path; // 고정 입력 엔진용 프로파일 전용 엔진 (비어 있으면 pose.model_path 공유)
+    };
+
     struct PoseConfig {
-        std::string model_path; // .trt 모델 파일 경로
+        std::string backend; // "tensorrt" (.trt 엔진) 또는 "opencv" (.onnx, OpenCV DNN CPU 추론)
+        std::string model_path; // .trt 모델 파일 경로 (opencv 백엔드는 .onnx)
+        std::string topology; // 관절 구성 "coco17", "wholebody133", "hand21" (PoseTopology.h)
         bool use_cuda; // CUDA 사용 여부
         float confidence_threshold;
         int input_width;
         int input_height;
         int heatmap_width;
         int heatmap_height;
+        int postprocess_threads; // 히트맵 argmax 병렬 스레드 수 (1이면 추론 스레드에서 순차 처리)
+        std::vector<InputProfile> profiles; // 비어 있으면 input_width x input_height 하나
         std::vector<float> mean; // [R, G, B] 순서
         std::vector<float> std;  // [R, G, B] 순서
     } pose;
+
+    // 다중 카메라 장치 설정 (비어 있으면 연결된 첫 번째 장치 하나 사용)
+    struct CameraConfig {
+        std::string serial;        // 장치 시리얼 번호 (비어 있으면 임의 장치)
+        std::string playback_file; // .bag 재생 파일 (지정 시 장치 대신 사용)
+        int sync_mode;             // RS2_OPTION_INTER_CAM_SYNC_MODE (0: 기본, 1: 마스터, 2: 슬레이브)
+    };
+    std::vector<CameraConfig> cameras;
+
+    struct {
+        double group_tolerance_ms; // 멀티뷰 프레임셋으로 묶을 최대 타임스탬프 차이 (0이면 검사 안 함)
+    } multi_camera;
+
+    struct {
+        bool headless; // true이면 HighGUI 창 없이 렌더링을 모두 건너뜀
+        int status_interval_sec; // 헤드리스 모드 상태 로그 출력 주기 (초)
+        bool hot_reload; // 설정 파일 변경 감시 후 재시작 없이 적용 (깊이 범위, CLAHE, 신뢰도 임계값, 저장 경로, 모델)
+    } runtime;
+
+    struct {
+        double max_fps; // 창 갱신 상한 (0이면 처리 속도 그대로, 추론 속도에는 영향 없음)
+        bool composite; // 포즈/깊이 뷰를 한 창에 나란히 표시
+    } display;
+
+    struct {
+        bool enabled; // 오버레이 포즈 뷰/깊이 컬러맵 동영상 녹화 (전용 인코더 스레드)
+        std::string directory;
+        std::string codec; // FourCC (mp4v, avc1: .mp4 / MJPG, XVID: .avi)
+        double fps; // 녹화 프레임 간격 (처리 속도보다 높으면 처리 속도로 기록)
+        int segment_seconds; // 세그먼트 최대 길이 (0이면 제한 없음)
+        int segment_mb; // 세그먼트 최대 크기 (포즈+깊이 파일 합계, 0이면 제한 없음)
+        int queue_size; // 인코더 대기 프레임 수 (가득 차면 드롭)
+        bool depth; // 깊이 컬러맵도 별도 파일로 녹화
+    } record;
+
+    struct {
+        bool enabled;
+        std::string socket_path; // 구독자가 바인딩하는 Unix 도메인 소켓 경로
+        bool include_3d; // 깊이 기반 3D 키포인트 포함 여부
+    } publish;
+
+    struct {
+        bool enabled;
+        std::string name; // POSIX 공유 메모리 이름 (/dev/shm 아래 생성)
+        int slots; // 링 슬롯 수 (소비자가 뒤처질 수 있는 최대 프레임 수)
+        int max_persons; // 슬롯당 최대 사람 수
+    } shared_memory;
+
+    struct {
+        bool enabled;
+        std::string bind_address; // 기본값 127.0.0.1 (로컬 스크레이프 전용)
+        int port;
+    } metrics;
+
+    struct {
+        bool log_enabled; // 프레임별 지연 로그 기록 여부
+        std::string log_path;
+        std::string log_format; // "csv" 또는 "json" (JSON Lines)
+    } latency;
+
+    struct {
+        bool enabled; // 깊이 기반 재실 게이트 (빈/정지 장면에서 추론 생략)
+        int decimation; // 깊이 샘플링 간격 (픽셀)
+        float foreground_threshold_mm; // 배경보다 이만큼 가까우면 전경
+        float foreground_ratio; // 전경 픽셀 비율이 이 값을 넘으면 재실
+        float motion_threshold_mm; // 직전 프레임 대비 깊이 변화 임계값
+        float motion_ratio; // 움직임 픽셀 비율이 이 값을 넘으면 재실
+        float background_alpha; // 배경 모델 갱신 비율 (장면이 비어 있을 때만)
+        int hold_ms; // 마지막 감지 후 추론을 유지하는 시간 (히스테리시스)
+        int heartbeat_ms; // 비활성 상태의 추론 주기
+        int min_keypoints; // 추론 결과로 재실을 유지하는 최소 키포인트 수
+        int absorb_ms; // 사람 검출 없이 전경이 이 시간 이상 지속되면 배경으로 흡수 (0 이하면 흡수 안 함)
+    } presence;
+
+    struct {
+        bool save_ply; // 's' 저장 시 사람별 점군을 PLY로 함께 저장
+        float voxel_size; // 복셀 다운샘플 크기 (미터, 0이면 다운샘플 없음)
+        float hull_margin; // 키포인트 볼록 껍질 확장 비율
+        float depth_band; // 키포인트 중앙 깊이 ± 범위 (미터, 0이면 제한 없음)
+    } pointcloud;
+
+    // 품질 조절 단계 (0단계가 최고 품질, 뒤로 갈수록 가벼움)
+    struct GovernorLevel {
+        int input_width;          // 모델 입력 크기 (동적 입력 엔진에서만 적용)
+        int input_height;
+        bool depth_visualization; // 깊이 시각화(CLAHE/컬러맵) 수행 여부
+        int inference_interval;   // N프레임마다 한 번 추론 (사이 프레임은 직전 결과 사용)
+        int depth_decimation;     // 깊이 데시메이션 배율 (1이면 사용 안 함)
+    };
+
+    struct {
+        bool enabled; // 목표 프레임 시간을 유지하도록 실행 중 품질 단계 조절
+        double target_frame_ms; // 목표 프레임 처리 시간
+        int window; // 판단에 쓰는 최근 프레임 수
+        double step_down_ratio; // 평균이 목표 x 이 값을 넘으면 한 단계 가볍게
+        double step_up_ratio; // 평균이 목표 x 이 값보다 작으면 한 단계 무겁게
+        int cooldown_frames; // 단계 변경 후 다음 판단까지 대기 프레임 수
+        std::vector<GovernorLevel> levels; // 비어 있으면 pose 설정에서 기본 단계 생성
+    } governor;
+
+    // 스레드 역할별 CPU 고정/실시간 우선순위
+    struct ThreadConfig {
+        std::string cpus; // "0-3,6" 형식 (비어 있으면 고정 안 함)
+        int priority;     // SCHED_FIFO 우선순위 1~99 (0이면 기본 스케줄링)
+    };
+
+    struct {
+        ThreadConfig capture;     // 카메라 캡처 (최신 프레임 모드 콜백, 다중 카메라 캡처 스레드)
+        ThreadConfig processing;  // 메인 처리 루프 (깊이 처리, 추론, 렌더링, 저장)
+        ThreadConfig postprocess; // 히트맵 argmax 스레드 풀 작업자
+        bool lock_memory;         // mlockall로 프로세스 메모리 고정
+    } threads;
 };
 
 class ConfigManager {
@@ -51,4 +181,10 @@ public:
     static bool loadConfig(const std::string& config_file, AppConfig& config);
     static void setDefaultConfig(AppConfig& config);
     static void printConfig(const AppConfig& config);
+
+    // 값 범위 검사 - 잘못된 항목을 모두 출력하고 하나라도 있으면 false
+    static bool validateConfig(const AppConfig& config);
+
+    // PoseEstimator를 다시 만들어야 하는 항목(백엔드, 모델, 입력/히트맵 크기, 후처리 스레드)이 바뀌었는지
+    static bool modelChanged(const AppConfig& before, const AppConfig& after);
 }; 
\ No newline at end of file
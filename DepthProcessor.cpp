@@ -1,6 +1,15 @@
 #include "DepthProcessor.h"
+#include <librealsense2/rsutil.h>
+#include "utils/FramePool.h"
 
 cv::Mat DepthProcessor::enhancedDepthVisualization(const rs2::depth_frame& depthFrame, const AppConfig& config) {
+    // 프레임 데이터를 복사 없이 래핑
+    cv::Mat depthRaw(depthFrame.get_height(), depthFrame.get_width(), CV_16UC1,
+                     const_cast<void*>(depthFrame.get_data()), depthFrame.get_stride_in_bytes());
+    return enhancedDepthVisualization(depthRaw, depthFrame.get_units(), config);
+}
+
+cv::Mat DepthProcessor::enhancedDepthVisualization(const cv::Mat& depthRaw, float depthUnits, const AppConfig& config) {
     float minDepth = config.depth_range.min;
     float maxDepth = config.depth_range.max;
     bool directConversion = config.visualization.direct_conversion;
@@ -8,9 +17,9 @@ cv::Mat DepthProcessor::enhancedDepthVisualization(const rs2::depth_frame& depth
     cv::Mat depth8bit;
     
     if (directConversion) {
-        depth8bit = DepthProcessor::directConversion(depthFrame, minDepth, maxDepth);
+        depth8bit = DepthProcessor::directConversion(depthRaw, depthUnits, minDepth, maxDepth);
     } else {
-        depth8bit = DepthProcessor::stepByStepConversion(depthFrame, minDepth, maxDepth);
+        depth8bit = DepthProcessor::stepByStepConversion(depthRaw, depthUnits, minDepth, maxDepth);
     }
     
     // CLAHE 적용
@@ -18,15 +27,11 @@ cv::Mat DepthProcessor::enhancedDepthVisualization(const rs2::depth_frame& depth
                                                      config.visualization.clahe.clip_limit, 
                                                      config.visualization.clahe.tile_grid_size);
     
-    // 히트맵으로 변환
-    cv::Mat colormap;
+    // 히트맵으로 변환 (결과는 표시/녹화/저장 단계가 모두 놓으면 풀로 반환)
+    cv::Mat colormap = Utils::FramePool::instance().attach();
     cv::applyColorMap(enhancedDepth, colormap, cv::COLORMAP_TURBO);
     
-    // 범위 정보를 이미지에 추가
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(2) << minDepth << "m ~ " << maxDepth << "m";
-    cv::putText(colormap, ss.str(), cv::Point(10, 20), cv::FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(255, 255, 255), 1);
-    
+    // 범위 문구는 표시 스레드가 미리 그려 둔 정적 오버레이로 합성
     return colormap;
 }
 
@@ -39,71 +44,81 @@ void DepthProcessor::drawCrosshair(cv::Mat& image, int size, const cv::Scalar& c
 }
 
 // 중앙 지점의 거리 계산 함수 구현
-float DepthProcessor::calculateCenterDistance(const rs2::depth_frame& depthFrame, float maxDepth, int windowSize) {
-    int centerX = depthFrame.get_width() / 2;
-    int centerY = depthFrame.get_height() / 2;
-    float centerDist = 0.0f;
-    int validCount = 0;
-    
-    // 중앙 주변 픽셀의 평균 거리 계산
-    for (int y = centerY - windowSize/2; y <= centerY + windowSize/2; y++) {
-        for (int x = centerX - windowSize/2; x <= centerX + windowSize/2; x++) {
-            if (y >= 0 && y < depthFrame.get_height() && x >= 0 && x < depthFrame.get_width()) {
-                float dist = depthFrame.get_distance(x, y);
-                if (dist > 0.001f && dist < maxDepth) { // 유효한 깊이 값만 포함
-                    centerDist += dist;
-                    validCount++;
-                }
-            }
-        }
-    }
-    
-    // 유효한 값이 있으면 평균 계산
-    if (validCount > 0) {
-        centerDist /= validCount;
-    } else {
-        // 유효한 깊이 값이 없으면 단일 중앙 픽셀 시도
-        centerDist = depthFrame.get_distance(centerX, centerY);
-    }
+float DepthProcessor::calculateCenterDistance(const DepthStatistics& depthStats, int windowSize) {
+    int centerX = depthStats.getWidth() / 2;
+    int centerY = depthStats.getHeight() / 2;
     
-    return centerDist;
+    // 중앙 주변 픽셀의 평균 거리 (유효 범위 판정은 통계 계산 시 적용됨)
+    return depthStats.mean(cv::Rect(centerX - windowSize / 2, centerY - windowSize / 2, windowSize, windowSize));
 }
 
-cv::Mat DepthProcessor::directConversion(const rs2::depth_frame& depthFrame, float minDepth, float maxDepth) {
+// 키포인트 3D 변환 함수 구현
+void DepthProcessor::deprojectKeypoints(const rs2::depth_frame& depthFrame, PoseResult& result) {
     int width = depthFrame.get_width();
     int height = depthFrame.get_height();
-    
-    // 깊이 프레임 데이터를 float 타입의 Mat으로 복사 (get_distance 사용 유지)
-    cv::Mat depthFloat(height, width, CV_32FC1);
-    for (int y = 0; y < height; y++) {
-        float* rowPtr = depthFloat.ptr<float>(y);
-        for (int x = 0; x < width; x++) {
-            rowPtr[x] = depthFrame.get_distance(x, y);
+    rs2_intrinsics intrinsics = depthFrame.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
+
+    float scaleX = result.imageWidth > 0 ? static_cast<float>(width) / result.imageWidth : 1.0f;
+    float scaleY = result.imageHeight > 0 ? static_cast<float>(height) / result.imageHeight : 1.0f;
+
+    for (int p = 0; p < result.numPersons; p++) {
+        for (int k = 0; k < result.numKeypoints; k++) {
+            result.cameraX[p][k] = 0.0f;
+            result.cameraY[p][k] = 0.0f;
+            result.cameraZ[p][k] = 0.0f;
+            if (!result.isVisible(p, k)) continue; // 무효 키포인트
+
+            float pixel[2] = {result.x[p][k] * scaleX, result.y[p][k] * scaleY};
+            int px = static_cast<int>(pixel[0]);
+            int py = static_cast<int>(pixel[1]);
+            if (px < 0 || px >= width || py < 0 || py >= height) continue;
+
+            float dist = depthFrame.get_distance(px, py);
+            if (dist <= 0.001f) continue; // 깊이 없음
+
+            float point3d[3];
+            rs2_deproject_pixel_to_point(point3d, &intrinsics, pixel, dist);
+            result.cameraX[p][k] = point3d[0];
+            result.cameraY[p][k] = point3d[1];
+            result.cameraZ[p][k] = point3d[2];
         }
     }
+    result.flags |= PoseResult::kHas3D;
+}
+
+cv::Mat DepthProcessor::directConversion(const cv::Mat& depthRaw, float depthUnits, float minDepth, float maxDepth) {
+    int width = depthRaw.cols;
+    int height = depthRaw.rows;
+    
+    // 원시 깊이 값을 미터 단위 float Mat으로 변환 (get_distance와 같은 값)
+    Utils::FramePool& pool = Utils::FramePool::instance();
+    cv::Mat depthFloat = pool.attach();
+    depthRaw.convertTo(depthFloat, CV_32FC1, depthUnits);
 
     // 유효 범위를 벗어나는 픽셀 마스크 생성 (minDepth <= depth <= maxDepth, depth > 0)
-    cv::Mat validMask;
+    cv::Mat validMask = pool.attach();
     cv::inRange(depthFloat, cv::Scalar(minDepth), cv::Scalar(maxDepth), validMask);
     
     // 0 이하인 픽셀 마스크 생성
-    cv::Mat positiveMask;
+    cv::Mat positiveMask = pool.attach();
     cv::compare(depthFloat, 0.0f, positiveMask, cv::CMP_GT);
 
     // 두 마스크 결합 (유효 범위이면서 양수인 픽셀)
     validMask &= positiveMask;
 
     // 유효하지 않은 픽셀을 0으로 설정
-    cv::Mat maskedDepth;
+    cv::Mat maskedDepth = pool.attach();
     depthFloat.copyTo(maskedDepth, validMask); // 유효한 값만 복사, 나머지는 0
     
     // 깊이 값 정규화 (min_depth ~ max_depth -> 0.0 ~ 1.0)
-    cv::Mat normalizedDepth = cv::Mat::zeros(height, width, CV_32FC1); // 0으로 초기화
+    cv::Mat normalizedDepth = pool.acquire(height, width, CV_32FC1);
+    normalizedDepth.setTo(0); // 0으로 초기화 (풀 버퍼는 이전 내용이 남아 있음)
     float range = maxDepth - minDepth;
     
     // 0으로 나누는 경우 방지
     if (range > 1e-6) {
-        cv::Mat temp = cv::Mat::zeros(height, width, CV_32FC1);
+        cv::Mat temp = pool.acquire(height, width, CV_32FC1);
+        temp.setTo(0);
         // 유효 픽셀에 대해 (depth - minDepth) 계산
         cv::subtract(depthFloat, minDepth, temp, validMask);
         // 전체 temp 행렬에 대해 range로 나누기 (유효하지 않은 영역은 0/range = 0)
@@ -113,55 +128,53 @@ cv::Mat DepthProcessor::directConversion(const rs2::depth_frame& depthFrame, flo
     }
 
     // 정규화된 float 이미지를 8비트로 변환 (0.0~1.0 -> 0~255)
-    cv::Mat depth8bit;
+    cv::Mat depth8bit = pool.attach();
     normalizedDepth.convertTo(depth8bit, CV_8UC1, 255.0);
     
     return depth8bit;
 }
 
-cv::Mat DepthProcessor::stepByStepConversion(const rs2::depth_frame& depthFrame, float minDepth, float maxDepth) {
-    int width = depthFrame.get_width();
-    int height = depthFrame.get_height();
+cv::Mat DepthProcessor::stepByStepConversion(const cv::Mat& depthRaw, float depthUnits, float minDepth, float maxDepth) {
+    int width = depthRaw.cols;
+    int height = depthRaw.rows;
 
-    // 깊이 프레임 데이터를 float 타입의 Mat으로 복사 (get_distance 사용 유지)
-    cv::Mat depthFloat(height, width, CV_32FC1);
-     for (int y = 0; y < height; y++) {
-        float* rowPtr = depthFloat.ptr<float>(y);
-        for (int x = 0; x < width; x++) {
-            rowPtr[x] = depthFrame.get_distance(x, y);
-        }
-    }
+    // 원시 깊이 값을 미터 단위 float Mat으로 변환 (get_distance와 같은 값)
+    Utils::FramePool& pool = Utils::FramePool::instance();
+    cv::Mat depthFloat = pool.attach();
+    depthRaw.convertTo(depthFloat, CV_32FC1, depthUnits);
 
     // 유효 범위를 벗어나는 픽셀 마스크 생성 (minDepth <= depth <= maxDepth, depth > 0)
-    cv::Mat validMask;
+    cv::Mat validMask = pool.attach();
     cv::inRange(depthFloat, cv::Scalar(minDepth), cv::Scalar(maxDepth), validMask);
     
     // 0 이하인 픽셀 마스크 생성
-    cv::Mat positiveMask;
+    cv::Mat positiveMask = pool.attach();
     cv::compare(depthFloat, 0.0f, positiveMask, cv::CMP_GT);
 
     // 두 마스크 결합 (유효 범위이면서 양수인 픽셀)
     validMask &= positiveMask;
 
     // 깊이 데이터를 16비트(0-65535) 범위로 정규화 (유효 픽셀 대상)
-    cv::Mat depth16bit = cv::Mat::zeros(height, width, CV_16UC1); // 0으로 초기화
+    cv::Mat depth16bit = pool.acquire(height, width, CV_16UC1);
+    depth16bit.setTo(0); // 0으로 초기화 (풀 버퍼는 이전 내용이 남아 있음)
     float range = maxDepth - minDepth; // range 변수 추가
 
     // 0으로 나누는 경우 방지
     if (range > 1e-6) {
         float scale = 65535.0f / range;
-        cv::Mat temp = cv::Mat::zeros(height, width, CV_32FC1);
+        cv::Mat temp = pool.acquire(height, width, CV_32FC1);
+        temp.setTo(0);
         // 유효 픽셀에 대해 (depth - minDepth) 계산
         cv::subtract(depthFloat, minDepth, temp, validMask);
         // 전체 temp 행렬에 대해 스케일링 및 타입 변환
-        cv::Mat temp16bit;
+        cv::Mat temp16bit = pool.attach();
         temp.convertTo(temp16bit, CV_16UC1, scale);
         // 마스크를 사용해 유효한 결과만 depth16bit에 복사
         temp16bit.copyTo(depth16bit, validMask);
     }
 
     // 16비트에서 8비트로 변환
-    cv::Mat depth8bit;
+    cv::Mat depth8bit = pool.attach();
     depth16bit.convertTo(depth8bit, CV_8UC1, 1.0/256.0);
     
     return depth8bit;
@@ -173,7 +186,7 @@ cv::Mat DepthProcessor::applyCLAHE(const cv::Mat& depthImage, double clipLimit,
     clahe->setClipLimit(clipLimit);
     clahe->setTilesGridSize(cv::Size(tileGridSize, tileGridSize));
     
-    cv::Mat enhancedDepth;
+    cv::Mat enhancedDepth = Utils::FramePool::instance().attach();
     clahe->apply(depthImage, enhancedDepth);
     
     return enhancedDepth;
@@ -206,4 +219,28 @@ void DepthProcessor::saveDepthToBin(const rs2::depth_frame& depthFrame, const st
     
     outfile.close();
     std::cout << "깊이 맵이 저장되었습니다: " << filename << std::endl;
-} 
\ No newline at end of file
+}
+
+void DepthProcessor::saveDepthIntrinsics(const rs2::depth_frame& depthFrame, const std::string& filename) {
+    rs2_intrinsics intrinsics = depthFrame.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
+    
+    cv::FileStorage fs(filename, cv::FileStorage::WRITE);
+    if (!fs.isOpened()) {
+        std::cerr << "파일을 열 수 없습니다: " << filename << std::endl;
+        return;
+    }
+    
+    fs << "width" << intrinsics.width;
+    fs << "height" << intrinsics.height;
+    fs << "fx" << intrinsics.fx;
+    fs << "fy" << intrinsics.fy;
+    fs << "ppx" << intrinsics.ppx;
+    fs << "ppy" << intrinsics.ppy;
+    fs << "model" << static_cast<int>(intrinsics.model);
+    fs << "coeffs" << "[";
+    for (int i = 0; i < 5; i++) {
+        fs << intrinsics.coeffs[i];
+    }
+    fs << "]";
+    fs.release();
+}
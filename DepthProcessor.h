@@ -3,32 +3,47 @@
 #include <opencv2/opencv.hpp>
 #include <librealsense2/rs.hpp>
 #include "ConfigManager.h"
+#include "PoseResult.h"
+#include "DepthStatistics.h"
 #include <string>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <vector>
 
 class DepthProcessor {
 public:
     // 깊이 이미지 시각화 함수 - 설정에 따라 변환 방식 선택
     static cv::Mat enhancedDepthVisualization(const rs2::depth_frame& depthFrame, const AppConfig& config);
     
+    // 복사해 둔 원시 Z16 깊이(CV_16UC1)와 깊이 단위(미터/값)로 시각화 (프레임을 반환한 뒤 다른 스레드에서 사용)
+    static cv::Mat enhancedDepthVisualization(const cv::Mat& depthRaw, float depthUnits, const AppConfig& config);
+    
     // 깊이 맵을 바이너리 파일로 저장하는 함수
     static void saveDepthToBin(const rs2::depth_frame& depthFrame, const std::string& filename);
     
-    // 중앙 지점의 거리 계산 함수 (픽셀 평균으로 안정성 향상)
-    static float calculateCenterDistance(const rs2::depth_frame& depthFrame, float maxDepth, int windowSize = 5);
+    // 깊이 스트림 내부 파라미터를 YAML로 저장 (오프라인에서 depth.bin 픽셀을 3D로 변환할 때 사용)
+    static void saveDepthIntrinsics(const rs2::depth_frame& depthFrame, const std::string& filename);
+    
+    // 중앙 지점의 거리 계산 함수 (windowSize x windowSize 유효 깊이 평균, 적분 영상으로 O(1))
+    // - 유효한 깊이가 없으면 0
+    static float calculateCenterDistance(const DepthStatistics& depthStats, int windowSize = 5);
+    
+    // 포즈 결과의 키포인트를 깊이 카메라 좌표계 3D 점(미터)으로 변환하여 cameraX/Y/Z에 기록
+    // - 컬러/깊이 스트림은 정렬되지 않으므로 해상도 비율(result.imageWidth/Height 기준)로 픽셀 위치를 근사
+    // - 깊이가 없거나 무효한 키포인트는 (0, 0, 0)
+    static void deprojectKeypoints(const rs2::depth_frame& depthFrame, PoseResult& result);
     
     // 이미지에 십자선 그리는 함수
     static void drawCrosshair(cv::Mat& image, int size = 10, const cv::Scalar& color = cv::Scalar(255, 255, 255));
     
 private:
     // 직접 변환 방식 (32비트 -> 8비트)
-    static cv::Mat directConversion(const rs2::depth_frame& depthFrame, float minDepth, float maxDepth);
+    static cv::Mat directConversion(const cv::Mat& depthRaw, float depthUnits, float minDepth, float maxDepth);
     
     // 단계별 변환 방식 (32비트 -> 16비트 -> 8비트)
-    static cv::Mat stepByStepConversion(const rs2::depth_frame& depthFrame, float minDepth, float maxDepth);
+    static cv::Mat stepByStepConversion(const cv::Mat& depthRaw, float depthUnits, float minDepth, float maxDepth);
     
     // CLAHE 적용
     static cv::Mat applyCLAHE(const cv::Mat& depthImage, double clipLimit, int tileGridSize);
@@ -0,0 +1,126 @@
+#include "DepthStatistics.h"
+#include <algorithm>
+#include <cmath>
+
+DepthStatistics::DepthStatistics(bool withSquares)
+    : withSquares(withSquares), width(0), height(0), depthScale(0.001f) {
+}
+
+void DepthStatistics::compute(const rs2::depth_frame& depthFrame, float maxDepth) {
+    int newWidth = depthFrame.get_width();
+    int newHeight = depthFrame.get_height();
+    depthScale = depthFrame.get_units();
+
+    // 해상도가 바뀔 때만 재할당 (첫 행/열은 0으로 유지)
+    if (newWidth != width || newHeight != height) {
+        width = newWidth;
+        height = newHeight;
+        size_t tableSize = static_cast<size_t>(width + 1) * (height + 1);
+        sumTable.assign(tableSize, 0);
+        countTable.assign(tableSize, 0);
+        squareTable.assign(withSquares ? tableSize : 0, 0);
+        rowSum.assign(width + 1, 0);
+        rowCount.assign(width + 1, 0);
+        rowSquare.assign(withSquares ? width + 1 : 0, 0);
+    }
+
+    uint32_t maxRaw = rawUpperBound(maxDepth, depthScale);
+
+    const uint8_t* data = static_cast<const uint8_t*>(depthFrame.get_data());
+    int stride = depthFrame.get_stride_in_bytes();
+    size_t tableStride = width + 1;
+
+    for (int y = 0; y < height; y++) {
+        const uint16_t* row = reinterpret_cast<const uint16_t*>(data + y * stride);
+
+        // 1) 행 방향 누적 (순차 의존)
+        uint64_t sum = 0;
+        uint32_t count = 0;
+        uint64_t square = 0;
+        for (int x = 0; x < width; x++) {
+            uint32_t depth = row[x];
+            uint32_t valid = (depth > 0 && depth < maxRaw) ? 1u : 0u;
+            uint32_t value = depth * valid;
+            sum += value;
+            count += valid;
+            rowSum[x + 1] = sum;
+            rowCount[x + 1] = count;
+            if (withSquares) {
+                square += static_cast<uint64_t>(value) * value;
+                rowSquare[x + 1] = square;
+            }
+        }
+
+        // 2) 윗행 적분값과 더하기 (원소 간 의존 없음 - 컴파일러 자동 벡터화)
+        const uint64_t* sumAbove = sumTable.data() + y * tableStride;
+        uint64_t* sumOut = sumTable.data() + (y + 1) * tableStride;
+        const uint32_t* countAbove = countTable.data() + y * tableStride;
+        uint32_t* countOut = countTable.data() + (y + 1) * tableStride;
+        for (size_t x = 1; x < tableStride; x++) {
+            sumOut[x] = sumAbove[x] + rowSum[x];
+            countOut[x] = countAbove[x] + rowCount[x];
+        }
+        if (withSquares) {
+            const uint64_t* squareAbove = squareTable.data() + y * tableStride;
+            uint64_t* squareOut = squareTable.data() + (y + 1) * tableStride;
+            for (size_t x = 1; x < tableStride; x++) {
+                squareOut[x] = squareAbove[x] + rowSquare[x];
+            }
+        }
+    }
+}
+
+uint32_t DepthStatistics::rawUpperBound(float maxDepth, float depthScale) {
+    if (maxDepth <= 0.0f || depthScale <= 0.0f) return 0x10000u;
+
+    // 나눗셈 결과는 float 반올림으로 경계 근처에서 한 단위 어긋날 수 있음 (3.0 / 0.001 = 2999.9998)
+    // → 올림 후 get_distance와 같은 float 비교(raw * depthScale < maxDepth)로 경계 값을 직접 확인해 보정
+    double bound = std::ceil(static_cast<double>(maxDepth) / depthScale);
+    if (bound > 0x10000) return 0x10000u;
+    uint32_t maxRaw = static_cast<uint32_t>(bound);
+    while (maxRaw > 0 && static_cast<float>(maxRaw - 1) * depthScale >= maxDepth) maxRaw--;
+    while (maxRaw < 0x10000u && static_cast<float>(maxRaw) * depthScale < maxDepth) maxRaw++;
+    return maxRaw;
+}
+
+DepthStatistics::RegionStats DepthStatistics::query(const cv::Rect& region) const {
+    RegionStats stats = {0.0f, 0.0f, 0.0f, 0};
+
+    cv::Rect clipped = region & cv::Rect(0, 0, width, height);
+    if (clipped.area() <= 0) return stats;
+
+    // 적분 영상 네 모서리 (x0,y0)-(x1,y1), 끝은 미포함
+    size_t tableStride = width + 1;
+    size_t i00 = clipped.y * tableStride + clipped.x;
+    size_t i01 = clipped.y * tableStride + clipped.x + clipped.width;
+    size_t i10 = (clipped.y + clipped.height) * tableStride + clipped.x;
+    size_t i11 = (clipped.y + clipped.height) * tableStride + clipped.x + clipped.width;
+
+    uint32_t count = countTable[i11] - countTable[i01] - countTable[i10] + countTable[i00];
+    stats.validCount = static_cast<int>(count);
+    stats.validFraction = static_cast<float>(count) / clipped.area();
+    if (count == 0) return stats;
+
+    uint64_t sum = sumTable[i11] - sumTable[i01] - sumTable[i10] + sumTable[i00];
+    double meanRaw = static_cast<double>(sum) / count;
+    stats.mean = static_cast<float>(meanRaw * depthScale);
+
+    if (withSquares) {
+        uint64_t square = squareTable[i11] - squareTable[i01] - squareTable[i10] + squareTable[i00];
+        double varianceRaw = static_cast<double>(square) / count - meanRaw * meanRaw;
+        stats.variance = static_cast<float>(std::max(0.0, varianceRaw) * depthScale * depthScale);
+    }
+    return stats;
+}
+
+float DepthStatistics::mean(const cv::Rect& region) const {
+    return query(region).mean;
+}
+
+int DepthStatistics::getWidth() const {
+    return width;
+}
+
+int DepthStatistics::getHeight() const {
+    return height;
+}
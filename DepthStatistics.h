@@ -0,0 +1,55 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <librealsense2/rs.hpp>
+#include <cstdint>
+#include <vector>
+
+// 프레임 단위 깊이 통계 - 원시 Z16에서 적분 영상(유효 깊이 합, 유효 개수, 선택적 제곱합)을 한 번 계산
+// - 이후 임의 사각형 영역의 평균/유효 비율/분산을 O(1)로 조회 (사람 박스, 관절 주변, 사용자 영역 등)
+// - 적분 영상은 (width+1) x (height+1) 크기이며 버퍼는 프레임 간 재사용
+class DepthStatistics {
+public:
+    // 영역 통계 (깊이는 미터)
+    struct RegionStats {
+        float mean;          // 유효 깊이 평균 (유효 픽셀이 없으면 0)
+        float variance;      // 유효 깊이 분산 (제곱합을 계산하지 않았으면 0)
+        float validFraction; // 영역 내 유효 깊이 픽셀 비율
+        int validCount;
+    };
+
+    // withSquares: 분산 조회가 필요할 때만 제곱합 적분 영상 계산
+    explicit DepthStatistics(bool withSquares = false);
+
+    // 깊이 프레임에서 적분 영상 계산 - 0 또는 maxDepth(미터) 이상은 무효 (maxDepth <= 0이면 상한 없음)
+    void compute(const rs2::depth_frame& depthFrame, float maxDepth = 0.0f);
+
+    // 사각형 영역 통계 (이미지 밖 부분은 잘라냄)
+    RegionStats query(const cv::Rect& region) const;
+
+    // 사각형 영역의 유효 깊이 평균 (미터)
+    float mean(const cv::Rect& region) const;
+
+    int getWidth() const;
+    int getHeight() const;
+
+    // maxDepth(미터) 상한을 원시 깊이 값 상한으로 변환 - raw < 반환값 ⇔ raw * depthScale < maxDepth (float 비교와 동일)
+    // maxDepth <= 0이면 Z16 최대값보다 큰 값 (상한 없음)
+    static uint32_t rawUpperBound(float maxDepth, float depthScale);
+
+private:
+    bool withSquares;
+    int width;
+    int height;
+    float depthScale; // 깊이 단위 → 미터
+
+    // 적분 영상 (행 우선, stride = width + 1)
+    std::vector<uint64_t> sumTable;
+    std::vector<uint32_t> countTable;
+    std::vector<uint64_t> squareTable;
+
+    // 행 누적값 임시 버퍼
+    std::vector<uint64_t> rowSum;
+    std::vector<uint32_t> rowCount;
+    std::vector<uint64_t> rowSquare;
+};
@@ -0,0 +1,122 @@
+#include "MultiCameraRig.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "utils/ThreadAffinity.h"
+
+MultiCameraRig::MultiCameraRig(const AppConfig& config)
+    : config(config), running(false), groupNumber(0), droppedCount(0) {
+}
+
+MultiCameraRig::~MultiCameraRig() {
+    stop();
+}
+
+bool MultiCameraRig::start() {
+    // 동기화 마스터를 먼저 시작해야 슬레이브가 트리거를 받을 수 있음
+    std::vector<size_t> order(config.cameras.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return config.cameras[a].sync_mode == 1 && config.cameras[b].sync_mode != 1;
+    });
+
+    cameras.resize(config.cameras.size());
+    for (size_t i : order) {
+        cameras[i].reset(new RealSenseCamera(config, &config.cameras[i]));
+        if (!cameras[i]->start()) {
+            std::cerr << "카메라 " << i << " (" << cameras[i]->getName() << ") 시작 실패" << std::endl;
+            return false;
+        }
+        std::cout << "카메라 " << i << " 시작됨: " << cameras[i]->getName() << std::endl;
+    }
+
+    slots.assign(cameras.size(), Slot{rs2::frameset(), 0.0, false});
+    running = true;
+    for (size_t i = 0; i < cameras.size(); i++) {
+        captureThreads.emplace_back(&MultiCameraRig::captureLoop, this, static_cast<int>(i));
+    }
+    return true;
+}
+
+void MultiCameraRig::stop() {
+    running = false;
+    frameArrived.notify_all();
+    for (auto& thread : captureThreads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    captureThreads.clear();
+}
+
+void MultiCameraRig::captureLoop(int index) {
+    Utils::ThreadAffinity::applyToCurrentThread("capture" + std::to_string(index), config.threads.capture.cpus,
+                                                config.threads.capture.priority);
+    
+    while (running) {
+        rs2::frameset frames;
+        if (!cameras[index]->getFrames(frames)) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        Slot& slot = slots[index];
+        if (slot.fresh) {
+            droppedCount++; // 묶이기 전에 더 새로운 프레임으로 교체됨
+        }
+        slot.frames = frames;
+        slot.timestampMs = frames.get_timestamp();
+        slot.fresh = true;
+        frameArrived.notify_one();
+    }
+}
+
+bool MultiCameraRig::getFrameset(MultiViewFrameset& frameset, int timeoutMs) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    double tolerance = config.multi_camera.group_tolerance_ms;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (running) {
+        bool allFresh = std::all_of(slots.begin(), slots.end(), [](const Slot& slot) { return slot.fresh; });
+        if (allFresh) {
+            auto minmax = std::minmax_element(slots.begin(), slots.end(), [](const Slot& a, const Slot& b) {
+                return a.timestampMs < b.timestampMs;
+            });
+            double spread = minmax.second->timestampMs - minmax.first->timestampMs;
+
+            if (tolerance <= 0.0 || spread <= tolerance) {
+                frameset.groupNumber = ++groupNumber;
+                frameset.spreadMs = spread;
+                frameset.views.resize(slots.size());
+                for (size_t i = 0; i < slots.size(); i++) {
+                    frameset.views[i].cameraIndex = static_cast<int>(i);
+                    frameset.views[i].frames = slots[i].frames;
+                    frameset.views[i].timestampMs = slots[i].timestampMs;
+                    slots[i].fresh = false;
+                }
+                return true;
+            }
+
+            // 허용 오차 밖: 가장 오래된 뷰를 버리고 해당 카메라의 다음 프레임을 기다림
+            minmax.first->fresh = false;
+            droppedCount++;
+        }
+
+        if (frameArrived.wait_until(lock, deadline) == std::cv_status::timeout) {
+            return false;
+        }
+    }
+    return false;
+}
+
+size_t MultiCameraRig::getCameraCount() const {
+    return cameras.size();
+}
+
+std::string MultiCameraRig::getCameraName(int index) const {
+    return cameras[index]->getName();
+}
+
+uint64_t MultiCameraRig::getDroppedCount() const {
+    return droppedCount;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <librealsense2/rs.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConfigManager.h"
+#include "RealSenseCamera.h"
+
+// 여러 RealSense 장치를 동시에 구동하는 클래스
+// - 장치마다 독립 파이프라인과 캡처 스레드를 두고 최신 프레임셋만 유지
+// - 타임스탬프가 허용 오차 안에 드는 프레임셋끼리 묶어 멀티뷰 프레임셋으로 제공 (추론 단계에서 배치 처리)
+class MultiCameraRig {
+public:
+    // 카메라 한 대의 뷰
+    struct View {
+        int cameraIndex;
+        rs2::frameset frames;
+        double timestampMs; // 프레임 타임스탬프 (장치 시간 도메인)
+    };
+
+    // 타임스탬프로 묶인 멀티뷰 프레임셋
+    struct MultiViewFrameset {
+        uint64_t groupNumber;
+        std::vector<View> views; // cameraIndex 순서
+        double spreadMs;         // 뷰 간 최대 타임스탬프 차이
+    };
+
+    MultiCameraRig(const AppConfig& config);
+    ~MultiCameraRig();
+
+    // 모든 카메라 시작 및 캡처 스레드 실행
+    bool start();
+
+    // 캡처 스레드 정지
+    void stop();
+
+    // 다음 멀티뷰 프레임셋 대기 (timeoutMs 내에 묶지 못하면 false)
+    bool getFrameset(MultiViewFrameset& frameset, int timeoutMs = 1000);
+
+    size_t getCameraCount() const;
+    std::string getCameraName(int index) const;
+
+    // 묶이지 못하고 버려진 프레임셋 수
+    uint64_t getDroppedCount() const;
+
+private:
+    // 카메라별 최신 프레임 슬롯
+    struct Slot {
+        rs2::frameset frames;
+        double timestampMs;
+        bool fresh; // 마지막 묶음 이후 새로 도착했는지
+    };
+
+    const AppConfig& config;
+    std::vector<std::unique_ptr<RealSenseCamera>> cameras;
+    std::vector<std::thread> captureThreads;
+    std::vector<Slot> slots;
+
+    std::mutex mutex;
+    std::condition_variable frameArrived;
+    std::atomic<bool> running;
+    uint64_t groupNumber;
+    std::atomic<uint64_t> droppedCount;
+
+    void captureLoop(int index);
+};
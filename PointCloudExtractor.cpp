@@ -0,0 +1,316 @@
+#include "PointCloudExtractor.h"
+#include <librealsense2/rsutil.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+#include "utils/CpuFeatures.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace {
+    // 나머지 원소 (SIMD 폭 미만) 스칼라 처리
+    inline void deprojectTail(const uint16_t* raw, const float* raysX, const float* raysY, int begin, int count,
+                              float scale, float* outX, float* outY, float* outZ) {
+        for (int i = begin; i < count; i++) {
+            float z = raw[i] * scale;
+            outZ[i] = z;
+            outX[i] = raysX[i] * z;
+            outY[i] = raysY[i] * z;
+        }
+    }
+
+#if defined(UTILS_HAVE_AVX2_KERNELS)
+    // AVX2 경로 (CpuFeatures::hasAvx2()일 때만 호출)
+    UTILS_AVX2_TARGET void deprojectRowAvx2(const uint16_t* raw, const float* raysX, const float* raysY, int count,
+                                            float scale, float* outX, float* outY, float* outZ) {
+        int i = 0;
+        const __m256 scaleVec = _mm256_set1_ps(scale);
+        for (; i + 8 <= count; i += 8) {
+            __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i));
+            __m256 z = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(packed)), scaleVec);
+            _mm256_storeu_ps(outZ + i, z);
+            _mm256_storeu_ps(outX + i, _mm256_mul_ps(_mm256_loadu_ps(raysX + i), z));
+            _mm256_storeu_ps(outY + i, _mm256_mul_ps(_mm256_loadu_ps(raysY + i), z));
+        }
+        deprojectTail(raw, raysX, raysY, i, count, scale, outX, outY, outZ);
+    }
+#endif
+
+    // 한 행 구간의 z = raw * scale, x = rayX * z, y = rayY * z
+    void deprojectRow(const uint16_t* raw, const float* raysX, const float* raysY, int count, float scale,
+                      float* outX, float* outY, float* outZ) {
+#if defined(UTILS_HAVE_AVX2_KERNELS)
+        if (Utils::CpuFeatures::hasAvx2()) {
+            deprojectRowAvx2(raw, raysX, raysY, count, scale, outX, outY, outZ);
+            return;
+        }
+#endif
+        int i = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        const float32x4_t scaleVec = vdupq_n_f32(scale);
+        for (; i + 8 <= count; i += 8) {
+            uint16x8_t packed = vld1q_u16(raw + i);
+            float32x4_t zLow = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(packed))), scaleVec);
+            float32x4_t zHigh = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(packed))), scaleVec);
+            vst1q_f32(outZ + i, zLow);
+            vst1q_f32(outZ + i + 4, zHigh);
+            vst1q_f32(outX + i, vmulq_f32(vld1q_f32(raysX + i), zLow));
+            vst1q_f32(outX + i + 4, vmulq_f32(vld1q_f32(raysX + i + 4), zHigh));
+            vst1q_f32(outY + i, vmulq_f32(vld1q_f32(raysY + i), zLow));
+            vst1q_f32(outY + i + 4, vmulq_f32(vld1q_f32(raysY + i + 4), zHigh));
+        }
+#endif
+        deprojectTail(raw, raysX, raysY, i, count, scale, outX, outY, outZ);
+    }
+
+    // 복셀 좌표 (각 축 21비트, 부호 있는 값을 오프셋으로 양수화) → 64비트 키
+    inline uint64_t voxelKey(int ix, int iy, int iz) {
+        const int64_t offset = 1 << 20;
+        const uint64_t mask = (1u << 21) - 1;
+        return ((static_cast<uint64_t>(ix + offset) & mask) << 42) |
+               ((static_cast<uint64_t>(iy + offset) & mask) << 21) |
+               (static_cast<uint64_t>(iz + offset) & mask);
+    }
+}
+
+PointCloudExtractor::PointCloudExtractor(const AppConfig& config)
+    : config(config), width(0), height(0), voxelStamp(0) {
+    std::memset(&intrinsics, 0, sizeof(intrinsics));
+}
+
+void PointCloudExtractor::applyConfig(const AppConfig& config) {
+    this->config = config;
+}
+
+void PointCloudExtractor::updateRays(const rs2::depth_frame& depthFrame) {
+    rs2_intrinsics current = depthFrame.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
+    if (width == current.width && height == current.height &&
+        std::memcmp(&intrinsics, &current, sizeof(current)) == 0) {
+        return;
+    }
+
+    // 왜곡 모델까지 반영하도록 librealsense 역투영을 깊이 1m 기준으로 픽셀마다 한 번 실행
+    intrinsics = current;
+    width = current.width;
+    height = current.height;
+    rayX.resize(static_cast<size_t>(width) * height);
+    rayY.resize(static_cast<size_t>(width) * height);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            float pixel[2] = {static_cast<float>(u), static_cast<float>(v)};
+            float point[3];
+            rs2_deproject_pixel_to_point(point, &intrinsics, pixel, 1.0f);
+            size_t index = static_cast<size_t>(v) * width + u;
+            rayX[index] = point[0];
+            rayY[index] = point[1];
+        }
+    }
+    rowX.resize(width);
+    rowY.resize(width);
+    rowZ.resize(width);
+}
+
+void PointCloudExtractor::deprojectRegion(const rs2::depth_frame& depthFrame, const cv::Rect& region,
+                                          const cv::Mat* regionMask, float minZ, float maxZ,
+                                          std::vector<Point>& cloud) {
+    const uint8_t* data = static_cast<const uint8_t*>(depthFrame.get_data());
+    int stride = depthFrame.get_stride_in_bytes();
+    float scale = depthFrame.get_units();
+
+    for (int v = region.y; v < region.y + region.height; v++) {
+        const uint16_t* row = reinterpret_cast<const uint16_t*>(data + static_cast<size_t>(v) * stride) + region.x;
+        size_t rayOffset = static_cast<size_t>(v) * width + region.x;
+        deprojectRow(row, &rayX[rayOffset], &rayY[rayOffset], region.width, scale,
+                     rowX.data(), rowY.data(), rowZ.data());
+
+        const uint8_t* maskRow = regionMask ? regionMask->ptr<uint8_t>(v - region.y) : nullptr;
+        for (int i = 0; i < region.width; i++) {
+            float z = rowZ[i];
+            if (z <= minZ || z >= maxZ) continue; // 깊이 없음(0) 포함
+            if (maskRow && !maskRow[i]) continue;
+            Point point = {rowX[i], rowY[i], z};
+            cloud.push_back(point);
+        }
+    }
+}
+
+size_t PointCloudExtractor::extract(const rs2::depth_frame& depthFrame, std::vector<Point>& cloud) {
+    cloud.clear();
+    updateRays(depthFrame);
+
+    float maxZ = config.depth_range.max > 0.0f ? config.depth_range.max : std::numeric_limits<float>::max();
+    deprojectRegion(depthFrame, cv::Rect(0, 0, width, height), nullptr, 0.0f, maxZ, cloud);
+    if (config.pointcloud.voxel_size > 0.0f) {
+        voxelDownsample(cloud);
+    }
+    return cloud.size();
+}
+
+size_t PointCloudExtractor::extractPerson(const rs2::depth_frame& depthFrame, const PoseResult& result, int person,
+                                          std::vector<Point>& cloud) {
+    cloud.clear();
+    if (person < 0 || person >= result.numPersons) {
+        return 0;
+    }
+    updateRays(depthFrame);
+
+    // 컬러 좌표 → 깊이 픽셀 (DepthProcessor::deprojectKeypoints와 같은 해상도 비율 근사)
+    float scaleX = result.imageWidth > 0 ? static_cast<float>(width) / result.imageWidth : 1.0f;
+    float scaleY = result.imageHeight > 0 ? static_cast<float>(height) / result.imageHeight : 1.0f;
+    const uint8_t* data = static_cast<const uint8_t*>(depthFrame.get_data());
+    int stride = depthFrame.get_stride_in_bytes();
+
+    hullInput.clear();
+    keypointDepths.clear();
+    for (int k = 0; k < result.numKeypoints; k++) {
+        if (!result.isVisible(person, k)) continue;
+        int px = static_cast<int>(result.x[person][k] * scaleX);
+        int py = static_cast<int>(result.y[person][k] * scaleY);
+        if (px < 0 || px >= width || py < 0 || py >= height) continue;
+        hullInput.push_back(cv::Point(px, py));
+
+        uint16_t raw = reinterpret_cast<const uint16_t*>(data + static_cast<size_t>(py) * stride)[px];
+        if (raw > 0) {
+            keypointDepths.push_back(raw * depthFrame.get_units());
+        }
+    }
+    if (hullInput.size() < 3) {
+        return 0;
+    }
+
+    // 볼록 껍질을 무게중심 기준으로 hull_margin만큼 확장 (팔다리 가장자리/머리 위쪽 보정)
+    cv::convexHull(hullInput, hull);
+    cv::Point2f center(0.0f, 0.0f);
+    for (const cv::Point& p : hull) {
+        center.x += p.x;
+        center.y += p.y;
+    }
+    center *= 1.0f / hull.size();
+    float grow = 1.0f + config.pointcloud.hull_margin;
+    for (cv::Point& p : hull) {
+        p.x = cvRound(center.x + (p.x - center.x) * grow);
+        p.y = cvRound(center.y + (p.y - center.y) * grow);
+    }
+
+    cv::Rect region = cv::boundingRect(hull) & cv::Rect(0, 0, width, height);
+    if (region.area() == 0) {
+        return 0;
+    }
+
+    // 경계 사각형 크기의 마스크에 볼록 다각형 채우기
+    mask.create(region.height, region.width, CV_8UC1);
+    mask.setTo(0);
+    for (cv::Point& p : hull) {
+        p.x -= region.x;
+        p.y -= region.y;
+    }
+    cv::fillConvexPoly(mask, hull, cv::Scalar(255));
+
+    // 키포인트 중앙 깊이 주변만 (껍질 안의 배경/가림 물체 제외)
+    float minZ = 0.0f;
+    float maxZ = config.depth_range.max > 0.0f ? config.depth_range.max : std::numeric_limits<float>::max();
+    if (config.pointcloud.depth_band > 0.0f && !keypointDepths.empty()) {
+        std::nth_element(keypointDepths.begin(), keypointDepths.begin() + keypointDepths.size() / 2, keypointDepths.end());
+        float median = keypointDepths[keypointDepths.size() / 2];
+        minZ = std::max(0.0f, median - config.pointcloud.depth_band);
+        maxZ = std::min(maxZ, median + config.pointcloud.depth_band);
+    }
+
+    deprojectRegion(depthFrame, region, &mask, minZ, maxZ, cloud);
+    if (config.pointcloud.voxel_size > 0.0f) {
+        voxelDownsample(cloud);
+    }
+    return cloud.size();
+}
+
+void PointCloudExtractor::voxelDownsample(std::vector<Point>& cloud) {
+    if (cloud.empty()) {
+        return;
+    }
+
+    // 점 개수의 2배 이상인 2의 거듭제곱 크기 (부하율 50% 이하)
+    size_t capacity = 1024;
+    while (capacity < cloud.size() * 2) {
+        capacity <<= 1;
+    }
+    if (voxels.size() < capacity) {
+        voxels.assign(capacity, VoxelSlot()); // stamp 0 = 빈 칸
+        voxelStamp = 0;
+    }
+    capacity = voxels.size();
+    size_t slotMask = capacity - 1;
+    if (++voxelStamp == 0) {
+        // stamp가 한 바퀴 돌면 전체 초기화
+        for (VoxelSlot& slot : voxels) {
+            slot.stamp = 0;
+        }
+        voxelStamp = 1;
+    }
+
+    float inverse = 1.0f / config.pointcloud.voxel_size;
+    usedSlots.clear();
+    for (const Point& p : cloud) {
+        uint64_t key = voxelKey(static_cast<int>(std::floor(p.x * inverse)),
+                                static_cast<int>(std::floor(p.y * inverse)),
+                                static_cast<int>(std::floor(p.z * inverse)));
+        size_t index = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & slotMask;
+        while (true) {
+            VoxelSlot& slot = voxels[index];
+            if (slot.stamp != voxelStamp) {
+                slot.key = key;
+                slot.stamp = voxelStamp;
+                slot.count = 1;
+                slot.sumX = p.x;
+                slot.sumY = p.y;
+                slot.sumZ = p.z;
+                usedSlots.push_back(static_cast<uint32_t>(index));
+                break;
+            }
+            if (slot.key == key) {
+                slot.count++;
+                slot.sumX += p.x;
+                slot.sumY += p.y;
+                slot.sumZ += p.z;
+                break;
+            }
+            index = (index + 1) & slotMask;
+        }
+    }
+
+    // 복셀 무게중심으로 교체 (처음 나타난 순서 유지)
+    cloud.resize(usedSlots.size());
+    for (size_t i = 0; i < usedSlots.size(); i++) {
+        const VoxelSlot& slot = voxels[usedSlots[i]];
+        float inverseCount = 1.0f / slot.count;
+        cloud[i].x = slot.sumX * inverseCount;
+        cloud[i].y = slot.sumY * inverseCount;
+        cloud[i].z = slot.sumZ * inverseCount;
+    }
+}
+
+bool PointCloudExtractor::writePly(const std::string& path, const std::vector<Point>& cloud) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "파일을 열 수 없습니다: " << path << std::endl;
+        return false;
+    }
+
+    file << "ply\n"
+         << "format binary_little_endian 1.0\n"
+         << "element vertex " << cloud.size() << "\n"
+         << "property float x\n"
+         << "property float y\n"
+         << "property float z\n"
+         << "end_header\n";
+    static_assert(sizeof(Point) == 3 * sizeof(float), "Point must be tightly packed for PLY export");
+    if (!cloud.empty()) {
+        file.write(reinterpret_cast<const char*>(cloud.data()), cloud.size() * sizeof(Point));
+    }
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <librealsense2/rs.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ConfigManager.h"
+#include "PoseResult.h"
+
+// 원시 Z16 깊이 프레임에서 점군(깊이 카메라 좌표, 미터)을 추출
+// - 픽셀별 광선 방향(x/z, y/z)을 내부 파라미터가 바뀔 때만 미리 계산해 두고, 행 단위 SIMD로 z와 곱함
+// - 사람별 추출은 키포인트 볼록 껍질(확장) 영역과 키포인트 중앙 깊이 주변 범위로 제한
+// - 선택적으로 해시 격자 복셀 다운샘플 (복셀마다 점들의 무게중심 하나)
+// - 결과는 호출자가 재사용하는 버퍼에 기록하며 내부 버퍼도 프레임 간 재사용
+class PointCloudExtractor {
+public:
+    struct Point {
+        float x;
+        float y;
+        float z;
+    };
+
+    // depth_range.max 이상 깊이는 제외, 복셀/볼록 껍질/깊이 범위는 pointcloud 설정 사용
+    PointCloudExtractor(const AppConfig& config);
+
+    // 프레임 전체 점군 - 점 개수 반환
+    size_t extract(const rs2::depth_frame& depthFrame, std::vector<Point>& cloud);
+
+    // 사람 한 명의 점군 (result 좌표는 컬러 이미지 기준, 해상도 비율로 깊이 픽셀 근사)
+    // - 보이는 키포인트가 3개 미만이면 빈 점군
+    size_t extractPerson(const rs2::depth_frame& depthFrame, const PoseResult& result, int person,
+                         std::vector<Point>& cloud);
+
+    // 핫 리로드된 깊이 범위/pointcloud 설정 반영 (추출과 같은 스레드에서 호출)
+    void applyConfig(const AppConfig& config);
+
+    // 바이너리 PLY(리틀 엔디언, float x/y/z) 저장
+    static bool writePly(const std::string& path, const std::vector<Point>& cloud);
+
+private:
+    // 깊이 해상도/내부 파라미터가 바뀌었을 때만 광선 표 재계산
+    void updateRays(const rs2::depth_frame& depthFrame);
+
+    // 영역 내 (마스크가 있으면 마스크 픽셀만) 깊이 [minZ, maxZ) 점을 cloud에 추가
+    void deprojectRegion(const rs2::depth_frame& depthFrame, const cv::Rect& region, const cv::Mat* regionMask,
+                         float minZ, float maxZ, std::vector<Point>& cloud);
+
+    // 해시 격자 복셀 다운샘플 (cloud를 복셀 무게중심으로 교체)
+    void voxelDownsample(std::vector<Point>& cloud);
+
+    AppConfig config; // 설정 복사본 (applyConfig로 갱신)
+
+    // 광선 표 (행 우선, 픽셀 (u, v)의 x/z, y/z)
+    int width;
+    int height;
+    rs2_intrinsics intrinsics;
+    std::vector<float> rayX;
+    std::vector<float> rayY;
+
+    // 행 단위 SIMD 결과 임시 버퍼
+    std::vector<float> rowX;
+    std::vector<float> rowY;
+    std::vector<float> rowZ;
+
+    // 사람 영역 마스크 (볼록 껍질 경계 사각형 크기)
+    cv::Mat mask;
+    std::vector<cv::Point> hullInput;
+    std::vector<cv::Point> hull;
+    std::vector<float> keypointDepths;
+
+    // 복셀 해시 격자 (개방 주소법, stamp가 현재 값이 아닌 칸은 빈 칸 - 호출마다 전체를 지우지 않음)
+    struct VoxelSlot {
+        uint64_t key;
+        uint32_t stamp;
+        uint32_t count;
+        float sumX;
+        float sumY;
+        float sumZ;
+    };
+    std::vector<VoxelSlot> voxels;
+    std::vector<uint32_t> usedSlots;
+    uint32_t voxelStamp;
+};
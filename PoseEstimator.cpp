@@ -1,140 +1,347 @@
 #include "PoseEstimator.h"
 #include <fstream>
+#ifdef WITH_TENSORRT
 #include <cuda_runtime_api.h>
+#endif
 #include <iostream>
 #include <opencv2/dnn.hpp>
+#include <chrono>
+#include <algorithm>
+#include "utils/ThreadAffinity.h"
+#include "utils/ColorConversion.h"
+#include "utils/FramePool.h"
 
+namespace {
+    // 두 시점 사이의 경과 시간 (밀리초)
+    double elapsedMs(const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& end) {
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+#ifdef WITH_TENSORRT
 // Logger 구현
 void Logger::log(Severity severity, const char* msg) noexcept {
     if (severity <= Severity::kWARNING) {
         std::cerr << "TensorRT: " << msg << std::endl;
     }
 }
-
-// COCO 키포인트 색상
-const cv::Scalar colors[] = {
-    cv::Scalar(255, 0, 0),     // 코
-    cv::Scalar(255, 85, 0),    // 왼쪽 눈
-    cv::Scalar(255, 170, 0),   // 오른쪽 눈
-    cv::Scalar(255, 255, 0),   // 왼쪽 귀
-    cv::Scalar(170, 255, 0),   // 오른쪽 귀
-    cv::Scalar(85, 255, 0),    // 왼쪽 어깨
-    cv::Scalar(0, 255, 0),     // 오른쪽 어깨
-    cv::Scalar(0, 255, 85),    // 왼쪽 팔꿈치
-    cv::Scalar(0, 255, 170),   // 오른쪽 팔꿈치
-    cv::Scalar(0, 255, 255),   // 왼쪽 손목
-    cv::Scalar(0, 170, 255),   // 오른쪽 손목
-    cv::Scalar(0, 85, 255),    // 왼쪽 엉덩이
-    cv::Scalar(0, 0, 255),     // 오른쪽 엉덩이
-    cv::Scalar(85, 0, 255),    // 왼쪽 무릎
-    cv::Scalar(170, 0, 255),   // 오른쪽 무릎
-    cv::Scalar(255, 0, 255),   // 왼쪽 발목
-    cv::Scalar(255, 0, 170)    // 오른쪽 발목
-};
-
-// COCO 키포인트 연결 정보
-const std::vector<std::pair<int, int>> skeleton = {
-    {5, 6},   // 어깨 - 어깨
-    {5, 7},   // 왼쪽 어깨 - 왼쪽 팔꿈치
-    {7, 9},   // 왼쪽 팔꿈치 - 왼쪽 손목
-    {6, 8},   // 오른쪽 어깨 - 오른쪽 팔꿈치
-    {8, 10},  // 오른쪽 팔꿈치 - 오른쪽 손목
-    {5, 11},  // 왼쪽 어깨 - 왼쪽 엉덩이
-    {6, 12},  // 오른쪽 어깨 - 오른쪽 엉덩이
-    {11, 12}, // 엉덩이 - 엉덩이
-    {11, 13}, // 왼쪽 엉덩이 - 왼쪽 무릎
-    {13, 15}, // 왼쪽 무릎 - 왼쪽 발목
-    {12, 14}, // 오른쪽 엉덩이 - 오른쪽 무릎
-    {14, 16}  // 오른쪽 무릎 - 오른쪽 발목
-};
+#endif
 
 PoseEstimator::PoseEstimator(const AppConfig& config) 
-    : config_(config), 
+    : 
+#ifdef WITH_TENSORRT
+      activeContext_(nullptr),
+      activeBindings_(nullptr),
+#endif
+      activeProfile_(-1),
+      useDnn_(config.pose.backend == "opencv"),
+      config_(config), 
       inputH(config.pose.input_height), 
       inputW(config.pose.input_width), 
-      numKeypoints(17), // COCO 모델 기준, 필요 시 설정 가능
+      outputSize(0),
+      numKeypoints(0), // pose.topology에서 결정 (PoseResult::kMaxKeypoints 이하)
       batchSize(1),
-      initialized_(false) // 초기화 플래그 false로 시작
+      heatmapH(config.pose.heatmap_height),
+      heatmapW(config.pose.heatmap_width),
+      dynamicInput(false),
+      maxInputH(config.pose.input_height),
+      maxInputW(config.pose.input_width),
+      initialized_(false), // 초기화 플래그 false로 시작
+      lastTimings_{0.0, 0.0, 0.0},
+      postprocessFn_(nullptr)
 {
+    // 관절 구성 선택 - 모델 출력 채널 수(히트맵 선택)와 후처리 구현이 여기에 따름
+    bool knownTopology = PoseTopology::visit(config_.pose.topology, [this](auto topology) {
+        using Topology = decltype(topology);
+        numKeypoints = Topology::kNumJoints;
+        postprocessFn_ = &PoseEstimator::postprocessFor<Topology>;
+    });
+    if (!knownTopology) {
+        std::cerr << "알 수 없는 관절 구성입니다: " << config_.pose.topology << std::endl;
+        return;
+    }
+    if (numKeypoints > PoseResult::kMaxKeypoints) {
+        std::cerr << "관절 구성 " << config_.pose.topology << "(관절 " << numKeypoints << "개)이 PoseResult 용량("
+                  << PoseResult::kMaxKeypoints << ")보다 큽니다. POSE_MAX_KEYPOINTS=" << numKeypoints
+                  << " 이상으로 다시 빌드하세요." << std::endl;
+        return;
+    }
+    
+    // 설정된 백엔드로 모델 로드, 해상도 프로파일별 버퍼 할당
+    bool loaded = useDnn_ ? initDnn() : initTensorRT();
+    if (!loaded) {
+        return;
+    }
+    allocateHostBuffers();
+    
+    // 기본 프로파일: pose.input 크기와 같은 프로파일 (없으면 첫 번째)
+    int defaultProfile = findProfile(config_.pose.input_width, config_.pose.input_height);
+    if (!selectProfile(defaultProfile >= 0 ? defaultProfile : 0)) {
+        std::cerr << "기본 해상도 프로파일을 적용할 수 없습니다." << std::endl;
+        return;
+    }
+    
+    // 히트맵 argmax 병렬 처리 스레드 풀
+    if (config_.pose.postprocess_threads > 1) {
+        const AppConfig::ThreadConfig& threadConfig = config_.threads.postprocess;
+        postprocessPool_.reset(new Utils::ThreadPool(config_.pose.postprocess_threads, [threadConfig]() {
+            Utils::ThreadAffinity::applyToCurrentThread("postprocess", threadConfig.cpus, threadConfig.priority);
+        }));
+    }
+    
+    initialized_ = true; // 모든 초기화 성공
+}
+
+PoseEstimator::~PoseEstimator() {
+    if (!initialized_) return; // 초기화 실패 시 남은 버퍼/엔진은 멤버 소멸자가 해제
+    
+#ifdef WITH_TENSORRT
+    if (useDnn_) return;
+    
+    // 디바이스 버퍼 해제 후 컨텍스트 -> 엔진 -> 런타임 순서로 소멸 (프로파일 전용 엔진 먼저)
+    profiles_.clear();
+    bindings.release();
+    
+    context.reset();
+    engine.reset();
+    runtime.reset();
+#endif
+}
+
+std::vector<AppConfig::InputProfile> PoseEstimator::requestedProfiles() const {
+    if (!config_.pose.profiles.empty()) {
+        return config_.pose.profiles;
+    }
+    AppConfig::InputProfile profile;
+    profile.width = config_.pose.input_width;
+    profile.height = config_.pose.input_height;
+    return std::vector<AppConfig::InputProfile>(1, profile);
+}
+
+void PoseEstimator::allocateHostBuffers() {
+    size_t maxInput = 0;
+    size_t maxHeatmap = 0;
+    for (const Profile& profile : profiles_) {
+        maxInput = std::max(maxInput, static_cast<size_t>(profile.inputW) * profile.inputH);
+        maxHeatmap = std::max(maxHeatmap, static_cast<size_t>(profile.heatmapW) * profile.heatmapH);
+    }
+    inputBufferHost.reset(new float[batchSize * 3 * maxInput]);
+    
+    // DNN 백엔드는 출력 blob을 직접 읽으므로 호스트 출력 버퍼 불필요
+    if (!useDnn_) {
+        outputBufferHost.reset(new float[batchSize * numKeypoints * maxHeatmap]);
+    }
+}
+
+bool PoseEstimator::initTensorRT() {
+#ifdef WITH_TENSORRT
     // CUDA 사용 여부 확인
     if (!config_.pose.use_cuda) {
         std::cerr << "[오류] PoseEstimator: config.yaml에서 use_cuda가 false로 설정되었습니다. TensorRT 모델은 CUDA가 필요합니다." << std::endl;
-        return; // 초기화 실패
+        return false;
+    }
+    
+    // TensorRT 런타임 생성 (공유 엔진과 프로파일 전용 엔진이 함께 사용)
+    runtime.reset(nvinfer1::createInferRuntime(logger));
+    if (!runtime) {
+        std::cerr << "TensorRT 런타임 생성 실패" << std::endl;
+        return false;
     }
 
     // 모델 로드 시 config에서 경로 사용
-    if (!loadEngine(config_.pose.model_path)) {
+    if (!loadEngine(config_.pose.model_path, engine, context)) {
         std::cerr << "TensorRT 엔진 로드 실패: " << config_.pose.model_path << std::endl;
-        return;
+        return false;
     }
     
-    // 입출력 인덱스 설정 - 모델의 실제 텐서 이름 사용
-    inputIndex = engine->getBindingIndex("input.1");
-    
-    // 모델에 출력 텐서가 2개 있으므로, 첫 번째 출력 텐서 사용
-    outputIndex = engine->getBindingIndex("onnx::Concat_2957");
-    
-    // 출력 텐서가 없으면 두 번째 출력 텐서 시도
-    if (outputIndex == -1) {
-        outputIndex = engine->getBindingIndex("2990");
+    // 바인딩 열거 - 입력 하나와 임의 개수의 출력 (텐서 이름에 의존하지 않음)
+    if (!bindings.init(*engine)) {
+        return false;
     }
+    int inputIndex = bindings.inputIndex();
     
-    if (inputIndex == -1 || outputIndex == -1) {
-        std::cerr << "TensorRT 모델 바인딩 인덱스를 찾을 수 없습니다." << std::endl;
-        std::cerr << "입력 인덱스: " << inputIndex << ", 출력 인덱스: " << outputIndex << std::endl;
-        return;
+    // 동적 입력 엔진 (입력 높이/너비가 -1): 최적화 프로파일 최대 크기로 버퍼를 할당하고 프로파일 간 입력 차원만 변경
+    nvinfer1::Dims inputDims = engine->getBindingDimensions(inputIndex);
+    dynamicInput = inputDims.d[2] < 0 || inputDims.d[3] < 0;
+    if (dynamicInput) {
+        inputDims = engine->getProfileDimensions(inputIndex, 0, nvinfer1::OptProfileSelector::kMAX);
+        context->setBindingDimensions(inputIndex, inputDims);
+        maxInputH = inputDims.d[2];
+        maxInputW = inputDims.d[3];
+        std::cout << "동적 입력 엔진: 최대 입력 크기 " << maxInputW << "x" << maxInputH << std::endl;
+    } else {
+        maxInputH = inputDims.d[2];
+        maxInputW = inputDims.d[3];
     }
     
-    // 출력 크기 계산
-    nvinfer1::Dims outputDims = engine->getBindingDimensions(outputIndex);
-    outputSize = 1;
-    for (int i = 0; i < outputDims.nbDims; i++) {
-        outputSize *= outputDims.d[i];
+    // 배치 크기: 명시적 배치 엔진의 입력 첫 번째 차원 (다중 카메라 뷰를 한 번에 추론)
+    batchSize = inputDims.d[0] > 0 ? inputDims.d[0] : 1;
+    
+    // 모든 바인딩에 대해 데이터 형식과 최대 차원 기준으로 디바이스 메모리 할당
+    if (!bindings.allocate(*context)) {
+        return false;
     }
     
-    // TensorRT 엔진의 바인딩 수 확인 (1 입력 + 2 출력 = 3)
-    int numBindings = engine->getNbBindings();
+    // 히트맵 출력은 pose.input 크기 기준으로 한 번만 선택 (모든 프로파일이 같은 출력 사용)
+    if (dynamicInput) {
+        inputDims.d[2] = std::min(config_.pose.input_height, maxInputH);
+        inputDims.d[3] = std::min(config_.pose.input_width, maxInputW);
+        context->setBindingDimensions(inputIndex, inputDims);
+        bindings.refresh(*context);
+    }
+    if (!bindings.selectHeatmaps(numKeypoints, config_.pose.heatmap_height, config_.pose.heatmap_width)) {
+        return false;
+    }
     
-    // 모든 바인딩에 대해 메모리 할당
-    for (int i = 0; i < numBindings; i++) {
-        nvinfer1::Dims dims = engine->getBindingDimensions(i);
-        size_t size = batchSize;
-        for (int j = 0; j < dims.nbDims; j++) {
-            size *= dims.d[j];
+    // 해상도 프로파일 준비 - 히트맵 크기는 프로파일 입력 크기에서의 엔진 출력 차원
+    for (const AppConfig::InputProfile& requested : requestedProfiles()) {
+        Profile profile;
+        profile.inputW = requested.width;
+        profile.inputH = requested.height;
+        Utils::EngineBindings* profileBindings = &bindings;
+        
+        // 프로파일 미지정 시 pose.input 크기를 엔진에 맞춤 (고정 입력은 엔진 크기, 동적 입력은 최대 크기 이하)
+        if (config_.pose.profiles.empty()) {
+            profile.inputW = dynamicInput ? std::min(requested.width, maxInputW) : maxInputW;
+            profile.inputH = dynamicInput ? std::min(requested.height, maxInputH) : maxInputH;
         }
-        cudaMalloc(&buffers[i], size * sizeof(float));
+        
+        if (!requested.model_path.empty()) {
+            if (!initProfileEngine(requested.model_path, profile)) {
+                return false;
+            }
+            profileBindings = profile.bindings.get();
+        } else if (dynamicInput) {
+            if (profile.inputW > maxInputW || profile.inputH > maxInputH) {
+                std::cerr << "해상도 프로파일 " << profile.inputW << "x" << profile.inputH
+                          << "이 엔진 최대 입력 크기 " << maxInputW << "x" << maxInputH << "를 넘습니다." << std::endl;
+                return false;
+            }
+            inputDims.d[2] = profile.inputH;
+            inputDims.d[3] = profile.inputW;
+            if (!context->setBindingDimensions(inputIndex, inputDims)) {
+                std::cerr << "해상도 프로파일을 적용할 수 없습니다: " << profile.inputW << "x" << profile.inputH << std::endl;
+                return false;
+            }
+            bindings.refresh(*context);
+        } else if (profile.inputW != maxInputW || profile.inputH != maxInputH) {
+            std::cerr << "고정 입력 엔진(" << maxInputW << "x" << maxInputH << ")에 없는 해상도 프로파일입니다: "
+                      << profile.inputW << "x" << profile.inputH << " (프로파일별 model_path를 지정하세요)" << std::endl;
+            return false;
+        }
+        
+        const nvinfer1::Dims& heatmapDims = profileBindings->binding(profileBindings->heatmapIndex()).dims;
+        profile.heatmapH = heatmapDims.d[2];
+        profile.heatmapW = heatmapDims.d[3];
+        std::cout << "해상도 프로파일 " << profiles_.size() << ": 입력 " << profile.inputW << "x" << profile.inputH
+                  << ", 히트맵 " << profile.heatmapW << "x" << profile.heatmapH
+                  << (profile.engine ? " (전용 엔진)" : "") << std::endl;
+        profiles_.push_back(std::move(profile));
     }
     
-    // 호스트 버퍼 할당
-    inputBufferHost = new float[batchSize * 3 * inputH * inputW];
-    outputBufferHost = new float[batchSize * outputSize];
+    return true;
+#else
+    std::cerr << "[오류] PoseEstimator: TensorRT 없이 빌드되었습니다 (WITH_TENSORRT=OFF). "
+              << "pose.backend를 \"opencv\"로 설정하고 ONNX 모델을 사용하세요." << std::endl;
+    return false;
+#endif
+}
+
+#ifdef WITH_TENSORRT
+bool PoseEstimator::initProfileEngine(const std::string& enginePath, Profile& profile) {
+    if (!loadEngine(enginePath, profile.engine, profile.context)) {
+        std::cerr << "프로파일 엔진 로드 실패: " << enginePath << std::endl;
+        return false;
+    }
+    profile.bindings.reset(new Utils::EngineBindings());
+    if (!profile.bindings->init(*profile.engine)) {
+        return false;
+    }
     
-    initialized_ = true; // 모든 초기화 성공
+    // 프로파일 전용 엔진은 고정 입력이어야 하고 공유 엔진과 배치 크기가 같아야 함
+    nvinfer1::Dims inputDims = profile.engine->getBindingDimensions(profile.bindings->inputIndex());
+    if (inputDims.d[2] != profile.inputH || inputDims.d[3] != profile.inputW) {
+        std::cerr << "프로파일 엔진 입력 크기가 프로파일 " << profile.inputW << "x" << profile.inputH
+                  << "과 다릅니다: " << enginePath << std::endl;
+        return false;
+    }
+    if ((inputDims.d[0] > 0 ? inputDims.d[0] : 1) != batchSize) {
+        std::cerr << "프로파일 엔진 배치 크기가 기본 엔진(" << batchSize << ")과 다릅니다: " << enginePath << std::endl;
+        return false;
+    }
+    
+    return profile.bindings->allocate(*profile.context) &&
+           profile.bindings->selectHeatmaps(numKeypoints, config_.pose.heatmap_height, config_.pose.heatmap_width);
 }
+#endif
 
-PoseEstimator::~PoseEstimator() {
-    if (!initialized_) return; // 초기화 실패 시 메모리 해제 건너뛰기
-    
-    // 모든 바인딩에 대해 메모리 해제
-    int numBindings = engine ? engine->getNbBindings() : 0;
-    for (int i = 0; i < numBindings; i++) {
-        if (buffers[i]) {
-            cudaFree(buffers[i]);
-            buffers[i] = nullptr;
-        }
+bool PoseEstimator::initDnn() {
+    try {
+        net_ = cv::dnn::readNetFromONNX(config_.pose.model_path);
+    } catch (const cv::Exception& e) {
+        std::cerr << "ONNX 모델 로드 실패: " << config_.pose.model_path << " (" << e.what() << ")" << std::endl;
+        return false;
+    }
+    if (net_.empty()) {
+        std::cerr << "ONNX 모델 로드 실패: " << config_.pose.model_path << std::endl;
+        return false;
     }
+    net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+    net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
     
-    // 호스트 버퍼 해제
-    delete[] inputBufferHost;
-    delete[] outputBufferHost;
+    std::vector<std::string> outputNames = net_.getUnconnectedOutLayersNames();
     
-    // 명시적으로 순서대로 소멸 (컨텍스트 -> 엔진 -> 런타임)
-    context.reset();
-    engine.reset();
-    runtime.reset();
+    // pose.input 크기로 한 번 실행해 출력 형태 확인 - 히트맵 출력은 이름이 아닌 형태로 선택
+    int probeShape[4] = {1, 3, config_.pose.input_height, config_.pose.input_width};
+    std::vector<cv::Mat> outputs;
+    try {
+        net_.setInput(cv::Mat(4, probeShape, CV_32F, cv::Scalar(0)));
+        net_.forward(outputs, outputNames);
+    } catch (const cv::Exception& e) {
+        std::cerr << "ONNX 모델 실행 실패: " << config_.pose.model_path << " (" << e.what() << ")" << std::endl;
+        return false;
+    }
+    std::vector<Utils::OutputShape> shapes;
+    for (const cv::Mat& output : outputs) {
+        shapes.push_back(output.dims == 4 ? Utils::OutputShape{output.size[1], output.size[2], output.size[3]}
+                                          : Utils::OutputShape{0, 0, 0});
+    }
+    int selected = Utils::selectHeatmapOutput(shapes, numKeypoints, config_.pose.heatmap_height, config_.pose.heatmap_width);
+    if (selected < 0) {
+        std::cerr << "ONNX 모델에서 히트맵 출력을 찾을 수 없습니다 (" << numKeypoints << "채널 이상의 NCHW 출력 필요)" << std::endl;
+        return false;
+    }
+    dnnOutputName_ = outputNames[selected];
+    
+    // 해상도 프로파일마다 한 번 실행해 히트맵 크기 결정 (입력 크기는 매 추론 시 blob 크기로 정해짐)
+    dynamicInput = true;
+    batchSize = 1;
+    for (const AppConfig::InputProfile& requested : requestedProfiles()) {
+        Profile profile;
+        profile.inputW = requested.width;
+        profile.inputH = requested.height;
+        probeShape[2] = requested.height;
+        probeShape[3] = requested.width;
+        try {
+            net_.setInput(cv::Mat(4, probeShape, CV_32F, cv::Scalar(0)));
+            cv::Mat output = net_.forward(dnnOutputName_);
+            profile.heatmapH = output.size[2];
+            profile.heatmapW = output.size[3];
+        } catch (const cv::Exception& e) {
+            std::cerr << "해상도 프로파일 " << requested.width << "x" << requested.height << " 실행 실패 (" << e.what() << ")" << std::endl;
+            return false;
+        }
+        profiles_.push_back(std::move(profile));
+    }
+    std::cout << "OpenCV DNN(CPU) 백엔드: " << config_.pose.model_path << " (출력 " << dnnOutputName_
+              << ", 해상도 프로파일 " << profiles_.size() << "개)" << std::endl;
+    return true;
 }
 
-bool PoseEstimator::loadEngine(const std::string& enginePath) {
+#ifdef WITH_TENSORRT
+bool PoseEstimator::loadEngine(const std::string& enginePath,
+                               std::unique_ptr<nvinfer1::ICudaEngine, TRTDestroy>& targetEngine,
+                               std::unique_ptr<nvinfer1::IExecutionContext, TRTDestroy>& targetContext) {
     std::ifstream file(enginePath, std::ios::binary);
     if (!file) {
         std::cerr << "TensorRT 엔진 파일을 열 수 없습니다: " << enginePath << std::endl;
@@ -151,60 +358,247 @@ bool PoseEstimator::loadEngine(const std::string& enginePath) {
     file.read(engineData.data(), size);
     file.close();
     
-    // TensorRT 런타임 생성 - 클래스 멤버 변수로 설정
-    runtime.reset(nvinfer1::createInferRuntime(logger));
-    if (!runtime) {
-        std::cerr << "TensorRT 런타임 생성 실패" << std::endl;
-        return false;
-    }
-    
     // 엔진 생성
-    engine.reset(runtime->deserializeCudaEngine(engineData.data(), size));
-    if (!engine) {
+    targetEngine.reset(runtime->deserializeCudaEngine(engineData.data(), size));
+    if (!targetEngine) {
         std::cerr << "TensorRT 엔진 생성 실패" << std::endl;
         return false;
     }
     
     // 실행 컨텍스트 생성
-    context.reset(engine->createExecutionContext());
-    if (!context) {
+    targetContext.reset(targetEngine->createExecutionContext());
+    if (!targetContext) {
         std::cerr << "TensorRT 실행 컨텍스트 생성 실패" << std::endl;
         return false;
     }
     
     return true;
 }
+#endif
 
-bool PoseEstimator::detect(const cv::Mat& image, std::vector<std::vector<cv::Point>>& keypoints) {
+bool PoseEstimator::detect(const cv::Mat& image, PoseResult& result, int profile) {
+    if (!isReady()) {
+        return false;
+    }
+    if (profile >= 0 && !selectProfile(profile)) {
+        std::cerr << "잘못된 해상도 프로파일: " << profile << std::endl;
+        return false;
+    }
+    
+    inferBatch(&image, 1, &result);
+    return true;
+}
+
+bool PoseEstimator::detectBatch(const std::vector<cv::Mat>& images, std::vector<PoseResult>& results) {
+    if (!isReady()) {
+        return false;
+    }
+    
+    // 뷰 수가 바뀔 때만 재할당
+    results.resize(images.size());
+    
+    // 엔진 배치 크기 단위로 나누어 추론 (배치 1 엔진이면 뷰마다 순차 실행, 모델은 하나만 사용)
+    StageTimings total{0.0, 0.0, 0.0};
+    for (size_t start = 0; start < images.size(); start += batchSize) {
+        int count = static_cast<int>(std::min(images.size() - start, static_cast<size_t>(batchSize)));
+        inferBatch(&images[start], count, &results[start]);
+        total.preprocessMs += lastTimings_.preprocessMs;
+        total.inferenceMs += lastTimings_.inferenceMs;
+        total.postprocessMs += lastTimings_.postprocessMs;
+    }
+    lastTimings_ = total;
+    
+    return true;
+}
+
+bool PoseEstimator::isReady() const {
     if (!initialized_) { // 초기화 확인 추가
         std::cerr << "[오류] PoseEstimator가 제대로 초기화되지 않았습니다." << std::endl;
         return false;
     }
     
-    if (!engine || !context) { // 기존 엔진/컨텍스트 확인 유지
+#ifdef WITH_TENSORRT
+    if (!useDnn_ && (!engine || !context)) { // 기존 엔진/컨텍스트 확인 유지
         std::cerr << "TensorRT 엔진이 초기화되지 않았습니다." << std::endl;
         return false;
     }
+#endif
     
-    // 이미지 전처리 (멤버 변수 사용)
-    preprocess(image, inputBufferHost);
+    return true;
+}
+
+void PoseEstimator::inferBatch(const cv::Mat* images, int count, PoseResult* results) {
+    int inputImageSize = 3 * inputH * inputW;
     
-    // 입력 데이터 GPU로 복사 (멤버 변수 사용)
-    cudaMemcpy(buffers[inputIndex], inputBufferHost, batchSize * 3 * inputH * inputW * sizeof(float), cudaMemcpyHostToDevice);
+    auto preprocessStart = std::chrono::steady_clock::now();
     
-    // 추론 실행
-    context->executeV2(buffers);
+    // 이미지 전처리 (배치 내 위치에 기록)
+    for (int i = 0; i < count; i++) {
+        preprocess(images[i], inputBufferHost.get() + i * inputImageSize);
+    }
     
-    // 출력 데이터 CPU로 복사 - 제거됨 (멤버 변수 사용)
-    cudaMemcpy(outputBufferHost, buffers[outputIndex], batchSize * outputSize * sizeof(float), cudaMemcpyDeviceToHost);
+    auto inferenceStart = std::chrono::steady_clock::now();
+    
+    float* output = runInference(count);
+    
+    auto postprocessStart = std::chrono::steady_clock::now();
     
     // 후처리를 통해 키포인트 추출 (멤버 변수 사용)
-    postprocess(outputBufferHost, image.size(), keypoints);
+    for (int i = 0; i < count; i++) {
+        (this->*postprocessFn_)(output + i * outputSize, images[i].size(), results[i]);
+    }
+    
+    auto postprocessEnd = std::chrono::steady_clock::now();
+    lastTimings_.preprocessMs = elapsedMs(preprocessStart, inferenceStart);
+    lastTimings_.inferenceMs = elapsedMs(inferenceStart, postprocessStart);
+    lastTimings_.postprocessMs = elapsedMs(postprocessStart, postprocessEnd);
+}
+
+float* PoseEstimator::runInference(int count) {
+    if (useDnn_) {
+        // 입력 버퍼를 복사 없이 NCHW blob으로 감싸 추론
+        int blobShape[4] = {count, 3, inputH, inputW};
+        cv::Mat blob(4, blobShape, CV_32F, inputBufferHost.get());
+        net_.setInput(blob);
+        dnnOutput_ = net_.forward(dnnOutputName_);
+        
+        // 출력 크기는 입력 크기에 따라 달라짐 (NCHW)
+        outputSize = static_cast<int>(dnnOutput_.total() / count);
+        if (dnnOutput_.dims == 4) {
+            heatmapH = dnnOutput_.size[2];
+            heatmapW = dnnOutput_.size[3];
+        }
+        return dnnOutput_.ptr<float>();
+    }
+    
+#ifdef WITH_TENSORRT
+    // 입력 데이터 GPU로 복사 (사용하는 이미지 수만큼)
+    int inputImageSize = 3 * inputH * inputW;
+    activeBindings_->copyInput(inputBufferHost.get(), count * inputImageSize);
+    
+    // 현재 프로파일의 컨텍스트로 추론 실행 (고정 배치 엔진은 남는 슬롯도 함께 계산되지만 결과는 사용하지 않음)
+    activeContext_->executeV2(activeBindings_->data());
+    
+    // 히트맵 채널만 CPU로 복사 (태그 채널과 사용하지 않는 출력은 복사하지 않음)
+    activeBindings_->copyHeatmaps(outputBufferHost.get(), count, numKeypoints);
+#endif
+    return outputBufferHost.get();
+}
+
+bool PoseEstimator::setInputResolution(int width, int height) {
+    if (!initialized_) return false;
+    int profile = findProfile(width, height);
+    if (profile < 0) {
+        return false;
+    }
+    return selectProfile(profile);
+}
+
+cv::Size PoseEstimator::getInputResolution() const {
+    return cv::Size(inputW, inputH);
+}
+
+int PoseEstimator::getProfileCount() const {
+    return static_cast<int>(profiles_.size());
+}
+
+cv::Size PoseEstimator::getProfileResolution(int profile) const {
+    if (profile < 0 || profile >= static_cast<int>(profiles_.size())) {
+        return cv::Size();
+    }
+    return cv::Size(profiles_[profile].inputW, profiles_[profile].inputH);
+}
+
+int PoseEstimator::findProfile(int width, int height) const {
+    for (size_t i = 0; i < profiles_.size(); i++) {
+        if (profiles_[i].inputW == width && profiles_[i].inputH == height) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool PoseEstimator::selectProfile(int profile) {
+    if (profile < 0 || profile >= static_cast<int>(profiles_.size())) return false;
+    if (profile == activeProfile_) return true;
+    const Profile& next = profiles_[profile];
+    
+#ifdef WITH_TENSORRT
+    if (!useDnn_) {
+        if (next.context) {
+            // 고정 입력 엔진: 미리 로드한 프로파일 전용 컨텍스트로 전환
+            activeContext_ = next.context.get();
+            activeBindings_ = next.bindings.get();
+        } else {
+            // 동적 입력 엔진: 공유 컨텍스트의 입력 차원만 변경 (버퍼는 최대 크기로 할당되어 있음)
+            if (dynamicInput) {
+                int inputIndex = bindings.inputIndex();
+                nvinfer1::Dims dims = context->getBindingDimensions(inputIndex);
+                dims.d[2] = next.inputH;
+                dims.d[3] = next.inputW;
+                if (!context->setBindingDimensions(inputIndex, dims)) {
+                    std::cerr << "입력 해상도 변경 실패: " << next.inputW << "x" << next.inputH << std::endl;
+                    return false;
+                }
+                bindings.refresh(*context);
+            }
+            activeContext_ = context.get();
+            activeBindings_ = &bindings;
+        }
+    }
+#endif
     
+    activeProfile_ = profile;
+    inputW = next.inputW;
+    inputH = next.inputH;
+    heatmapW = next.heatmapW;
+    heatmapH = next.heatmapH;
+    
+    // 호스트 출력은 이미지별 히트맵 채널만 연속 배치
+    outputSize = numKeypoints * heatmapH * heatmapW;
     return true;
 }
 
+int PoseEstimator::getActiveProfile() const {
+    return activeProfile_;
+}
+
+int PoseEstimator::getNumKeypoints() const {
+    return numKeypoints;
+}
+
+bool PoseEstimator::isInitialized() const {
+    return initialized_;
+}
+
+bool PoseEstimator::applyConfig(const AppConfig& config) {
+    if (ConfigManager::modelChanged(config_, config)) {
+        return false;
+    }
+    // 전처리/후처리가 프레임마다 config_에서 읽으므로 다음 detect부터 적용
+    config_ = config;
+    return true;
+}
+
+const PoseEstimator::StageTimings& PoseEstimator::getLastTimings() const {
+    return lastTimings_;
+}
+
 void PoseEstimator::preprocess(const cv::Mat& image, float* inputBuffer) {
+    // YUYV 프레임: 색 변환/리사이즈/정규화/CHW 배치를 한 번에 처리 (중간 BGR 영상 없음)
+    if (image.type() == CV_8UC2) {
+        // 아래 blobFromImage 경로와 같은 입력 값이 되도록 채널별 평균/표준편차 대응을 그대로 따름
+        Utils::ColorConversion::Normalization norm;
+        for (int c = 0; c < 3; ++c) {
+            float stdVal = config_.pose.std[2 - c];
+            if (std::abs(stdVal) < 1e-6) stdVal = 1.0f;
+            norm.offset[c] = config_.pose.mean[2 - c];
+            norm.scale[c] = 1.0f / (255.0f * stdVal);
+        }
+        Utils::ColorConversion::yuyvToTensor(image, inputW, inputH, norm, inputBuffer);
+        return;
+    }
+    
     // cv::dnn::blobFromImage를 사용하여 전처리
     // 설정에서 mean, std 값 가져오기
     cv::Scalar mean(config_.pose.mean[0], config_.pose.mean[1], config_.pose.mean[2]);
@@ -214,8 +608,9 @@ void PoseEstimator::preprocess(const cv::Mat& image, float* inputBuffer) {
     // 현재 mean, std는 RGB 순서로 가정하고 로드했으므로, BGR 순서로 변경하여 사용
     cv::Scalar meanBGR(mean[2], mean[1], mean[0]);
 
-    // inputW, inputH는 멤버 변수 사용
-    cv::Mat blob = cv::dnn::blobFromImage(image, 1.0/255.0, cv::Size(inputW, inputH), meanBGR, true, false);
+    // inputW, inputH는 멤버 변수 사용 (blob은 프레임 풀 버퍼 - 프레임마다 새로 할당하지 않음)
+    cv::Mat blob = Utils::FramePool::instance().attach();
+    cv::dnn::blobFromImage(image, blob, 1.0/255.0, cv::Size(inputW, inputH), meanBGR, true, false);
     
     // std도 BGR 순서에 맞게 사용
     cv::Scalar stdBGR(std[2], std[1], std[0]); 
@@ -240,60 +635,67 @@ void PoseEstimator::preprocess(const cv::Mat& image, float* inputBuffer) {
     }
 }
 
-void PoseEstimator::postprocess(float* outputBuffer, const cv::Size& originalSize, std::vector<std::vector<cv::Point>>& keypoints) {
-    keypoints.clear();
-    keypoints.resize(1); // 한 명의 사람만 가정
-    keypoints[0].resize(numKeypoints);
+template <typename Topology>
+void PoseEstimator::postprocessFor(float* outputBuffer, const cv::Size& originalSize, PoseResult& result) {
+    constexpr int kJoints = PoseTopology::storedJoints<Topology>();
+    
+    // 프레임 번호는 호출자가 기록
+    result.reset(0, kJoints, originalSize.width, originalSize.height,
+                 config_.pose.confidence_threshold);
+    int person = result.addPerson(); // 한 명의 사람만 가정
     
-    // 설정에서 히트맵 크기 가져오기
-    int heatmapH = config_.pose.heatmap_height;
-    int heatmapW = config_.pose.heatmap_width;
-    int heatmapSize = heatmapH * heatmapW;
+    // 모든 키포인트 채널의 최대값과 위치를 SIMD 커널로 한 번에 탐색 (스레드 풀이 있으면 채널 분할)
+    if (postprocessPool_) {
+        postprocessPool_->parallelFor(kJoints, [this, outputBuffer](int begin, int end) {
+            Utils::HeatmapArgmax::findPeaks(outputBuffer + begin * heatmapH * heatmapW, end - begin,
+                                            heatmapH, heatmapW, peaks_ + begin);
+        });
+    } else {
+        Utils::HeatmapArgmax::findPeaks(outputBuffer, kJoints, heatmapH, heatmapW, peaks_);
+    }
 
-    for (int k = 0; k < numKeypoints; k++) {
-        // 현재 키포인트(채널)의 히트맵 데이터에 대한 Mat 헤더 생성 (복사 없음)
-        cv::Mat heatmap(heatmapH, heatmapW, CV_32FC1, outputBuffer + k * heatmapSize);
-        
-        // 히트맵에서 최대값과 위치 찾기
-        double maxValDouble;
-        cv::Point maxLoc;
-        cv::minMaxLoc(heatmap, nullptr, &maxValDouble, nullptr, &maxLoc);
-        float maxVal = static_cast<float>(maxValDouble);
-        
-        // 원본 이미지 크기로 스케일링
-        float x = static_cast<float>(maxLoc.x) / heatmapW * originalSize.width;
-        float y = static_cast<float>(maxLoc.y) / heatmapH * originalSize.height;
+    for (int k = 0; k < kJoints; k++) {
+        int maxX = peaks_[k].index % heatmapW;
+        int maxY = peaks_[k].index / heatmapW;
         
-        // 신뢰도가 임계값보다 높으면 키포인트 추가 (설정값 사용)
-        if (maxVal > config_.pose.confidence_threshold) {
-            keypoints[0][k] = cv::Point(static_cast<int>(x), static_cast<int>(y));
-        } else {
-            keypoints[0][k] = cv::Point(-1, -1); // 신뢰도가 낮은 키포인트는 무효화
-        }
+        // 원본 이미지 크기로 스케일링 (신뢰도 판정은 score와 scoreThreshold로)
+        result.x[person][k] = static_cast<float>(maxX) / heatmapW * originalSize.width;
+        result.y[person][k] = static_cast<float>(maxY) / heatmapH * originalSize.height;
+        result.score[person][k] = peaks_[k].value;
     }
 }
 
-void PoseEstimator::drawKeypoints(cv::Mat& image, const std::vector<std::vector<cv::Point>>& keypoints) {
-    if (keypoints.empty()) return;
+void PoseEstimator::drawKeypoints(cv::Mat& image, const PoseResult& result) {
+    PoseTopology::visit(result.numKeypoints, [&image, &result](auto topology) {
+        drawKeypointsFor<decltype(topology)>(image, result);
+    });
+}
+
+template <typename Topology>
+void PoseEstimator::drawKeypointsFor(cv::Mat& image, const PoseResult& result) {
+    constexpr int kJoints = PoseTopology::storedJoints<Topology>();
     
     // 각 사람에 대해
-    for (const auto& person : keypoints) {
+    for (int p = 0; p < result.numPersons; p++) {
         // 키포인트 그리기
-        for (int i = 0; i < person.size(); i++) {
-            if (person[i].x >= 0 && person[i].y >= 0) { // 유효한 키포인트만
-                cv::circle(image, person[i], 5, colors[i], -1);
+        for (int i = 0; i < kJoints; i++) {
+            if (result.isVisible(p, i)) { // 유효한 키포인트만
+                const PoseTopology::Color& color = Topology::kColors[i];
+                cv::Point point(static_cast<int>(result.x[p][i]), static_cast<int>(result.y[p][i]));
+                cv::circle(image, point, Topology::kPointRadius, cv::Scalar(color.b, color.g, color.r), -1);
             }
         }
         
         // 스켈레톤 그리기 (키포인트 연결)
-        for (const auto& limb : skeleton) {
-            int i = limb.first;
-            int j = limb.second;
-            if (i < person.size() && j < person.size() &&
-                person[i].x >= 0 && person[i].y >= 0 &&
-                person[j].x >= 0 && person[j].y >= 0) {
-                cv::line(image, person[i], person[j], cv::Scalar(255, 255, 255), 2);
+        for (int l = 0; l < Topology::kNumLimbs; l++) {
+            int i = Topology::kLimbs[l].from;
+            int j = Topology::kLimbs[l].to;
+            if (i < kJoints && j < kJoints && result.isVisible(p, i) && result.isVisible(p, j)) {
+                cv::line(image,
+                         cv::Point(static_cast<int>(result.x[p][i]), static_cast<int>(result.y[p][i])),
+                         cv::Point(static_cast<int>(result.x[p][j]), static_cast<int>(result.y[p][j])),
+                         cv::Scalar(255, 255, 255), 2);
             }
         }
     }
-} 
\ No newline at end of file
+}
@@ -1,12 +1,21 @@
 #pragma once
 
 #include <opencv2/opencv.hpp>
+#include <opencv2/dnn.hpp>
+#ifdef WITH_TENSORRT
 #include <NvInfer.h>
+#endif
 #include <vector>
 #include <string>
 #include <memory>
 #include "ConfigManager.h" // AppConfig 사용 위해 추가
+#include "PoseResult.h"
+#include "PoseTopology.h"
+#include "utils/EngineBindings.h"
+#include "utils/HeatmapArgmax.h"
+#include "utils/ThreadPool.h"
 
+#ifdef WITH_TENSORRT
 // Logger 클래스 정의 (NvInfer의 ILogger 구현)
 class Logger : public nvinfer1::ILogger {
 public:
@@ -22,52 +31,174 @@ struct TRTDestroy {
         }
     }
 };
+#endif
 
 // 포즈 추정 클래스
+// - pose.backend "tensorrt": 직렬화된 TensorRT 엔진 (WITH_TENSORRT 빌드에서만)
+// - pose.backend "opencv": ONNX 모델을 OpenCV DNN으로 CPU 추론 (GPU 없는 환경, 회귀 검사용)
+// - 입력 해상도 프로파일(pose.profiles)은 생성 시 모두 준비 - detect 호출마다 재할당/모델 재로드 없이 선택
+//   (동적 입력 엔진은 최대 크기 버퍼를 공유하고 입력 차원만 변경, 고정 입력 엔진은 프로파일별 엔진/컨텍스트를 미리 로드)
+// - 관절 구성(pose.topology)은 생성 시 한 번 선택 - 후처리/그리기는 토폴로지별 템플릿 구현 (관절 수가 상수)
 class PoseEstimator {
 public:
+    // 마지막 detect 호출의 단계별 소요 시간 (밀리초)
+    struct StageTimings {
+        double preprocessMs;
+        double inferenceMs;
+        double postprocessMs;
+    };
+
+
     // 생성자: AppConfig를 받아 초기화
     PoseEstimator(const AppConfig& config);
     ~PoseEstimator();
 
-    // 이미지에서 포즈 추정 실행
-    bool detect(const cv::Mat& image, std::vector<std::vector<cv::Point>>& keypoints);
+    // 이미지에서 포즈 추정 실행 - 결과는 호출자가 재사용하는 PoseResult에 기록
+    // - image: BGR(CV_8UC3) 또는 카메라 원본 YUYV(CV_8UC2, 색 변환을 전처리에서 함께 수행)
+    // - profile: 이번 호출에 쓸 해상도 프로파일 (음수면 현재 프로파일, 선택한 프로파일은 이후 호출에도 유지)
+    bool detect(const cv::Mat& image, PoseResult& result, int profile = -1);
+    
+    // 여러 이미지(다중 카메라 뷰)에서 포즈 추정 - 현재 프로파일로 엔진 배치 크기만큼 묶어서 추론
+    bool detectBatch(const std::vector<cv::Mat>& images, std::vector<PoseResult>& results);
+    
+    // 준비된 해상도 프로파일 수와 프로파일별 입력 크기
+    int getProfileCount() const;
+    cv::Size getProfileResolution(int profile) const;
+    
+    // 입력 크기가 같은 프로파일 번호 (없으면 -1)
+    int findProfile(int width, int height) const;
+    
+    // 현재 프로파일 변경 (버퍼 재할당/모델 재로드 없음) - 범위를 벗어나면 false
+    bool selectProfile(int profile);
+    int getActiveProfile() const;
+    
+    // 입력 크기가 같은 프로파일 선택 - 준비된 프로파일이 없으면 false, 현재 해상도 유지
+    bool setInputResolution(int width, int height);
     
-    // 이미지에 키포인트 그리기
-    static void drawKeypoints(cv::Mat& image, const std::vector<std::vector<cv::Point>>& keypoints);
+    // 현재 모델 입력 해상도
+    cv::Size getInputResolution() const;
+    
+    // 모델 키포인트 수
+    int getNumKeypoints() const;
+    
+    // 모델 로드/버퍼 할당 성공 여부
+    bool isInitialized() const;
+    
+    // 엔진을 유지한 채 적용 가능한 설정 반영 (신뢰도 임계값, 전처리 정규화) - detect와 같은 스레드에서 프레임 사이에 호출
+    // - 모델 관련 항목(ConfigManager::modelChanged)이 바뀌었으면 false, 호출자가 새 PoseEstimator를 만들어야 함
+    bool applyConfig(const AppConfig& config);
+    
+    // 마지막 detect 호출의 단계별 소요 시간
+    const StageTimings& getLastTimings() const;
+    
+    // 이미지에 키포인트 그리기 - 결과의 관절 수로 토폴로지 선택 (알 수 없는 관절 수면 그리지 않음)
+    static void drawKeypoints(cv::Mat& image, const PoseResult& result);
 
 private:
+#ifdef WITH_TENSORRT
     // TensorRT 관련 변수
     Logger logger;
     std::unique_ptr<nvinfer1::IRuntime, TRTDestroy> runtime;
     std::unique_ptr<nvinfer1::ICudaEngine, TRTDestroy> engine;
     std::unique_ptr<nvinfer1::IExecutionContext, TRTDestroy> context;
     
-    const AppConfig& config_; // 설정 객체 참조
+    // 현재 프로파일의 실행 컨텍스트/바인딩 (공유 또는 프로파일 전용)
+    nvinfer1::IExecutionContext* activeContext_;
+    Utils::EngineBindings* activeBindings_;
+#endif
+    
+    // 해상도 프로파일 (입력 크기와 그에 따른 히트맵 크기)
+    struct Profile {
+        int inputW;
+        int inputH;
+        int heatmapW;
+        int heatmapH;
+#ifdef WITH_TENSORRT
+        // 고정 입력 엔진 대체 경로: 프로파일 전용 엔진/컨텍스트/버퍼 (비어 있으면 공유 엔진 사용)
+        std::unique_ptr<nvinfer1::ICudaEngine, TRTDestroy> engine;
+        std::unique_ptr<nvinfer1::IExecutionContext, TRTDestroy> context;
+        std::unique_ptr<Utils::EngineBindings> bindings;
+#endif
+    };
+    std::vector<Profile> profiles_;
+    int activeProfile_;
+    
+    // OpenCV DNN 백엔드 (useDnn_일 때만 사용)
+    bool useDnn_;
+    cv::dnn::Net net_;
+    std::string dnnOutputName_;
+    cv::Mat dnnOutput_;
+    
+    AppConfig config_; // 설정 복사본 (핫 리로드 스냅샷이 교체되어도 유효, applyConfig로 갱신)
     bool initialized_; // 초기화 성공 여부 플래그
+    StageTimings lastTimings_;
     
-    // 모델 관련 변수
+    // 모델 관련 변수 (입력/히트맵/출력 크기는 현재 프로파일 값)
     int inputH;
     int inputW;
     int outputSize;
     int numKeypoints;
-    int batchSize;
+    int batchSize; // 엔진 입력 배치 크기 (명시적 배치 엔진의 첫 번째 차원)
+    int heatmapH;
+    int heatmapW;
+    bool dynamicInput; // 입력 높이/너비가 동적인 엔진 (프로파일 간 입력 차원만 변경)
+    int maxInputH; // 공유 버퍼 할당 기준 최대 입력 크기
+    int maxInputW;
+    
+#ifdef WITH_TENSORRT
+    // 공유 엔진 입출력 디바이스 버퍼 (바인딩 수/이름과 무관, 히트맵 출력은 형태로 선택)
+    Utils::EngineBindings bindings;
+#endif
+    
+    // 호스트 메모리 버퍼 (CPU) - 출력은 이미지별 히트맵 채널만 (태그 채널 제외)
+    // - 초기화 도중 실패해도 해제되도록 소유 포인터로 보관
+    std::unique_ptr<float[]> inputBufferHost;
+    std::unique_ptr<float[]> outputBufferHost;
+    
+    // 후처리: 채널별 히트맵 최대값/위치, 채널 분할용 스레드 풀 (postprocess_threads > 1일 때만)
+    Utils::HeatmapArgmax::Peak peaks_[PoseResult::kMaxKeypoints];
+    std::unique_ptr<Utils::ThreadPool> postprocessPool_;
+    
+    // pose.topology에 맞는 후처리 구현 (postprocessFor<Topology>)
+    typedef void (PoseEstimator::*PostprocessFn)(float* outputBuffer, const cv::Size& originalSize, PoseResult& result);
+    PostprocessFn postprocessFn_;
     
-    // 입출력 버퍼 - 최대 바인딩 개수를 3으로 변경 (1 입력 + 2 출력)
-    void* buffers[3];
-    int inputIndex;
-    int outputIndex;
+    // 엔진/컨텍스트 사용 가능 여부 확인
+    bool isReady() const;
     
-    // 호스트 메모리 버퍼 (CPU)
-    float* inputBufferHost;
-    float* outputBufferHost;
+    // 준비할 프로파일 목록 (pose.profiles, 없으면 pose.input 크기 하나)
+    std::vector<AppConfig::InputProfile> requestedProfiles() const;
+    
+    // 모든 프로파일 중 최대 입출력 크기로 호스트 버퍼 할당
+    void allocateHostBuffers();
+    
+    // 최대 batchSize개의 이미지를 한 번에 추론
+    void inferBatch(const cv::Mat* images, int count, PoseResult* results);
+    
+    // 입력 버퍼의 count개 이미지 추론 - 이미지별 출력이 outputSize 간격으로 놓인 호스트 포인터 반환
+    float* runInference(int count);
     
     // 전처리 함수: OpenCV Mat을 TensorRT 입력 형식으로 변환
     void preprocess(const cv::Mat& image, float* inputBuffer);
     
-    // 후처리 함수: TensorRT 출력을 키포인트 목록으로 변환
-    void postprocess(float* outputBuffer, const cv::Size& originalSize, std::vector<std::vector<cv::Point>>& keypoints);
+    // 후처리 함수: 히트맵 출력을 포즈 결과로 변환 (관절 수가 컴파일 타임 상수)
+    template <typename Topology>
+    void postprocessFor(float* outputBuffer, const cv::Size& originalSize, PoseResult& result);
+    
+    // 토폴로지 표(색, 연결)로 키포인트 그리기
+    template <typename Topology>
+    static void drawKeypointsFor(cv::Mat& image, const PoseResult& result);
+    
+    // 백엔드별 모델 로드 및 버퍼 할당
+    bool initTensorRT();
+    bool initDnn();
+    
+#ifdef WITH_TENSORRT
+    // TensorRT 엔진 파일 로드 및 실행 컨텍스트 생성
+    bool loadEngine(const std::string& enginePath, std::unique_ptr<nvinfer1::ICudaEngine, TRTDestroy>& targetEngine,
+                    std::unique_ptr<nvinfer1::IExecutionContext, TRTDestroy>& targetContext);
     
-    // TensorRT 엔진 로드
-    bool loadEngine(const std::string& enginePath);
+    // 프로파일 전용 엔진 로드 및 버퍼 할당 (고정 입력 엔진, 입력/배치 크기 확인)
+    bool initProfileEngine(const std::string& enginePath, Profile& profile);
+#endif
 }; 
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+// 사람당 관절 용량 - 빌드 옵션 (CMake POSE_MAX_KEYPOINTS, 기본 COCO 17)
+// - 17 관절보다 많은 토폴로지는 관절 수 이상으로 빌드 (손 21점은 21, COCO-WholeBody는 133 - 결과 구조체와 복사/저장 크기가 함께 커짐)
+#ifndef POSE_MAX_KEYPOINTS
+#define POSE_MAX_KEYPOINTS 17
+#endif
+
+// 프레임 하나의 포즈 추정 결과
+// - 고정 용량 구조체 배열(SoA): 관절별 x, y, score와 선택적 카메라 좌표(3D)
+// - 호출자가 소유하고 프레임마다 재사용하므로 결과 경로에서 힙 할당이 없음
+// - 포인터/가변 길이 멤버가 없어 메모리 그대로 파일이나 소켓에 기록 가능 (리틀 엔디언 기준)
+struct PoseResult {
+    static const int kMaxPersons = 16;
+    static const int kMaxKeypoints = POSE_MAX_KEYPOINTS;
+
+    static const uint32_t kMagic = 0x53455250; // "PRES"
+    static const uint16_t kVersion = 1;
+
+    // flags 비트
+    static const uint16_t kHas3D = 0x0001; // cameraX/Y/Z가 채워져 있음
+
+    // 헤더 (40바이트)
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint64_t frameNumber;
+    int32_t numPersons;
+    int32_t numKeypoints;
+    int32_t imageWidth;      // 좌표 기준 이미지 크기
+    int32_t imageHeight;
+    float scoreThreshold;    // 이 값 이하의 score는 검출되지 않은 관절
+    uint32_t reserved;
+
+    // 관절별 데이터 [사람][관절]
+    float x[kMaxPersons][kMaxKeypoints];       // 이미지 픽셀 좌표
+    float y[kMaxPersons][kMaxKeypoints];
+    float score[kMaxPersons][kMaxKeypoints];   // 히트맵 최대값
+    float cameraX[kMaxPersons][kMaxKeypoints]; // 카메라 좌표 (미터, 깊이 없으면 0)
+    float cameraY[kMaxPersons][kMaxKeypoints];
+    float cameraZ[kMaxPersons][kMaxKeypoints];
+
+    // 새 프레임 결과 시작 (헤더만 초기화, 배열은 사람 추가 시 덮어씀)
+    void reset(uint64_t frame, int keypointCount, int width, int height, float threshold) {
+        magic = kMagic;
+        version = kVersion;
+        flags = 0;
+        frameNumber = frame;
+        numPersons = 0;
+        numKeypoints = keypointCount;
+        imageWidth = width;
+        imageHeight = height;
+        scoreThreshold = threshold;
+        reserved = 0;
+    }
+
+    // 사람 슬롯 추가 - 관절 값은 0으로 초기화, 용량 초과 시 -1
+    int addPerson() {
+        if (numPersons >= kMaxPersons) return -1;
+        int person = numPersons++;
+        for (int k = 0; k < kMaxKeypoints; k++) {
+            x[person][k] = 0.0f;
+            y[person][k] = 0.0f;
+            score[person][k] = 0.0f;
+            cameraX[person][k] = 0.0f;
+            cameraY[person][k] = 0.0f;
+            cameraZ[person][k] = 0.0f;
+        }
+        return person;
+    }
+
+    // 관절이 검출되었는지 (신뢰도가 임계값 초과)
+    bool isVisible(int person, int keypoint) const {
+        return score[person][keypoint] > scoreThreshold;
+    }
+
+    // 검출된 관절 수 (모든 사람 합계)
+    int countVisible() const {
+        int count = 0;
+        for (int p = 0; p < numPersons; p++) {
+            for (int k = 0; k < numKeypoints; k++) {
+                if (isVisible(p, k)) count++;
+            }
+        }
+        return count;
+    }
+
+    bool has3D() const {
+        return (flags & kHas3D) != 0;
+    }
+};
+
+static_assert(std::is_trivially_copyable<PoseResult>::value, "PoseResult must stay memcpy-able");
+static_assert(std::is_standard_layout<PoseResult>::value, "PoseResult must have a stable layout");
+static_assert(offsetof(PoseResult, x) == 40, "PoseResult header layout changed");
+static_assert(sizeof(PoseResult) == 40 + 6 * sizeof(float) * PoseResult::kMaxPersons * PoseResult::kMaxKeypoints,
+              "PoseResult must not contain padding");
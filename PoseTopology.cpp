@@ -0,0 +1,18 @@
+#include "PoseTopology.h"
+
+// constexpr 정적 배열/포인터 정의 (C++14에서는 실행 시 인덱스로 접근하려면 클래스 밖 정의가 필요)
+namespace PoseTopology {
+    constexpr Limb Coco17::kLimbs[];
+    constexpr FlipPair Coco17::kFlipPairTable[];
+    constexpr const FlipPair* Coco17::kFlipPairs;
+    constexpr Color Coco17::kColors[];
+
+    constexpr Limb WholeBody133::kLimbs[];
+    constexpr FlipPair WholeBody133::kFlipPairTable[];
+    constexpr const FlipPair* WholeBody133::kFlipPairs;
+    constexpr Color WholeBody133::kColors[];
+
+    constexpr Limb Hand21::kLimbs[];
+    constexpr const FlipPair* Hand21::kFlipPairs;
+    constexpr Color Hand21::kColors[];
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "PoseResult.h"
+
+// 포즈 모델 관절 구성(토폴로지) - 관절 수, 연결(뼈대), 좌우 대칭 쌍, 표시 색을 컴파일 타임 상수 표로 정의
+// - 후처리/그리기는 토폴로지 타입을 템플릿 인자로 받아 반복 횟수가 상수인 루프로 생성
+// - 실행 시에는 설정 이름(pose.topology) 또는 결과의 관절 수로 한 번만 분기 (visit)
+// - 관절 순서는 각 데이터셋(COCO, COCO-WholeBody, 손 21점) 정의를 따름
+namespace PoseTopology {
+    struct Limb {
+        int from;
+        int to;
+    };
+
+    // 좌우 반전 시 서로 바뀌는 관절 쌍 (토폴로지마다 kFlipPairs 포인터 + kNumFlipPairs 개수, 쌍이 없으면 nullptr/0)
+    struct FlipPair {
+        int left;
+        int right;
+    };
+
+    // 표시 색 (cv::Scalar와 같은 BGR 순서)
+    struct Color {
+        uint8_t b;
+        uint8_t g;
+        uint8_t r;
+    };
+
+    // COCO 17 관절 (기본 HigherHRNet 모델)
+    struct Coco17 {
+        static constexpr int kNumJoints = 17;
+        static constexpr int kNumLimbs = 12;
+        static constexpr int kNumFlipPairs = 8;
+        static constexpr int kPointRadius = 5;
+        static constexpr Limb kLimbs[kNumLimbs] = {
+            {5, 6}, // 어깨 - 어깨
+            {5, 7}, // 왼쪽 어깨 - 왼쪽 팔꿈치
+            {7, 9}, // 왼쪽 팔꿈치 - 왼쪽 손목
+            {6, 8}, // 오른쪽 어깨 - 오른쪽 팔꿈치
+            {8, 10}, // 오른쪽 팔꿈치 - 오른쪽 손목
+            {5, 11}, // 왼쪽 어깨 - 왼쪽 엉덩이
+            {6, 12}, // 오른쪽 어깨 - 오른쪽 엉덩이
+            {11, 12}, // 엉덩이 - 엉덩이
+            {11, 13}, // 왼쪽 엉덩이 - 왼쪽 무릎
+            {13, 15}, // 왼쪽 무릎 - 왼쪽 발목
+            {12, 14}, // 오른쪽 엉덩이 - 오른쪽 무릎
+            {14, 16}  // 오른쪽 무릎 - 오른쪽 발목
+        };
+        static constexpr FlipPair kFlipPairTable[kNumFlipPairs] = {
+            {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16}
+        };
+        static constexpr const FlipPair* kFlipPairs = kFlipPairTable;
+        static constexpr Color kColors[kNumJoints] = {
+            {255, 0, 0}, // 코
+            {255, 85, 0}, // 왼쪽 눈
+            {255, 170, 0}, // 오른쪽 눈
+            {255, 255, 0}, // 왼쪽 귀
+            {170, 255, 0}, // 오른쪽 귀
+            {85, 255, 0}, // 왼쪽 어깨
+            {0, 255, 0}, // 오른쪽 어깨
+            {0, 255, 85}, // 왼쪽 팔꿈치
+            {0, 255, 170}, // 오른쪽 팔꿈치
+            {0, 255, 255}, // 왼쪽 손목
+            {0, 170, 255}, // 오른쪽 손목
+            {0, 85, 255}, // 왼쪽 엉덩이
+            {0, 0, 255}, // 오른쪽 엉덩이
+            {85, 0, 255}, // 왼쪽 무릎
+            {170, 0, 255}, // 오른쪽 무릎
+            {255, 0, 255}, // 왼쪽 발목
+            {255, 0, 170}  // 오른쪽 발목
+        };
+    };
+
+    // COCO-WholeBody 133 관절: 몸 0-16, 발 17-22, 얼굴 23-90, 왼손 91-111, 오른손 112-132
+    // - 얼굴 관절은 점만 그림 (연결 없음), 손은 손목에서 이어서 그림
+    struct WholeBody133 {
+        static constexpr int kNumJoints = 133;
+        static constexpr int kNumLimbs = 60;
+        static constexpr int kNumFlipPairs = 61;
+        static constexpr int kPointRadius = 2;
+        static constexpr Limb kLimbs[kNumLimbs] = {
+            {5, 6}, {5, 7}, {7, 9}, {6, 8}, {8, 10}, {5, 11}, {6, 12}, {11, 12},
+            {11, 13}, {13, 15}, {12, 14}, {14, 16}, {15, 17}, {15, 18}, {15, 19}, {16, 20},
+            {16, 21}, {16, 22}, {9, 91}, {10, 112}, {91, 92}, {92, 93}, {93, 94}, {94, 95},
+            {91, 96}, {96, 97}, {97, 98}, {98, 99}, {91, 100}, {100, 101}, {101, 102}, {102, 103},
+            {91, 104}, {104, 105}, {105, 106}, {106, 107}, {91, 108}, {108, 109}, {109, 110}, {110, 111},
+            {112, 113}, {113, 114}, {114, 115}, {115, 116}, {112, 117}, {117, 118}, {118, 119}, {119, 120},
+            {112, 121}, {121, 122}, {122, 123}, {123, 124}, {112, 125}, {125, 126}, {126, 127}, {127, 128},
+            {112, 129}, {129, 130}, {130, 131}, {131, 132}
+        };
+        static constexpr FlipPair kFlipPairTable[kNumFlipPairs] = {
+            {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16},
+            {17, 20}, {18, 21}, {19, 22}, {23, 39}, {24, 38}, {25, 37}, {26, 36}, {27, 35},
+            {28, 34}, {29, 33}, {30, 32}, {40, 49}, {41, 48}, {42, 47}, {43, 46}, {44, 45},
+            {54, 58}, {55, 57}, {59, 68}, {60, 67}, {61, 66}, {62, 65}, {63, 70}, {64, 69},
+            {71, 77}, {72, 76}, {73, 75}, {82, 78}, {81, 79}, {83, 87}, {84, 86}, {90, 88},
+            {91, 112}, {92, 113}, {93, 114}, {94, 115}, {95, 116}, {96, 117}, {97, 118}, {98, 119},
+            {99, 120}, {100, 121}, {101, 122}, {102, 123}, {103, 124}, {104, 125}, {105, 126}, {106, 127},
+            {107, 128}, {108, 129}, {109, 130}, {110, 131}, {111, 132}
+        };
+        static constexpr const FlipPair* kFlipPairs = kFlipPairTable;
+        static constexpr Color kColors[kNumJoints] = {
+            {255, 0, 0}, {255, 85, 0}, {255, 170, 0}, {255, 255, 0}, {170, 255, 0}, {85, 255, 0},
+            {0, 255, 0}, {0, 255, 85}, {0, 255, 170}, {0, 255, 255}, {0, 170, 255}, {0, 85, 255},
+            {0, 0, 255}, {85, 0, 255}, {170, 0, 255}, {255, 0, 255}, {255, 0, 170}, {255, 0, 255},
+            {255, 0, 255}, {255, 0, 255}, {255, 0, 170}, {255, 0, 170}, {255, 0, 170}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255}, {255, 255, 255},
+            {255, 255, 255}, {255, 255, 255}, {255, 128, 0}, {255, 128, 0}, {255, 128, 0}, {255, 128, 0},
+            {255, 153, 255}, {255, 153, 255}, {255, 153, 255}, {255, 153, 255}, {102, 178, 255}, {102, 178, 255},
+            {102, 178, 255}, {102, 178, 255}, {255, 51, 51}, {255, 51, 51}, {255, 51, 51}, {255, 51, 51},
+            {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0}, {255, 255, 255}, {255, 128, 0},
+            {255, 128, 0}, {255, 128, 0}, {255, 128, 0}, {255, 153, 255}, {255, 153, 255}, {255, 153, 255},
+            {255, 153, 255}, {102, 178, 255}, {102, 178, 255}, {102, 178, 255}, {102, 178, 255}, {255, 51, 51},
+            {255, 51, 51}, {255, 51, 51}, {255, 51, 51}, {0, 255, 0}, {0, 255, 0}, {0, 255, 0},
+            {0, 255, 0}
+        };
+    };
+
+    // 손 21 관절: 손목 0, 엄지 1-4, 검지 5-8, 중지 9-12, 약지 13-16, 새끼 17-20 (한 손 모델이라 대칭 쌍 없음)
+    struct Hand21 {
+        static constexpr int kNumJoints = 21;
+        static constexpr int kNumLimbs = 20;
+        static constexpr int kNumFlipPairs = 0;
+        static constexpr int kPointRadius = 3;
+        static constexpr Limb kLimbs[kNumLimbs] = {
+            {0, 1}, {1, 2}, {2, 3}, {3, 4}, {0, 5}, {5, 6}, {6, 7}, {7, 8},
+            {0, 9}, {9, 10}, {10, 11}, {11, 12}, {0, 13}, {13, 14}, {14, 15}, {15, 16},
+            {0, 17}, {17, 18}, {18, 19}, {19, 20}
+        };
+        static constexpr const FlipPair* kFlipPairs = nullptr;
+        static constexpr Color kColors[kNumJoints] = {
+            {255, 255, 255}, {255, 128, 0}, {255, 128, 0}, {255, 128, 0}, {255, 128, 0}, {255, 153, 255},
+            {255, 153, 255}, {255, 153, 255}, {255, 153, 255}, {102, 178, 255}, {102, 178, 255}, {102, 178, 255},
+            {102, 178, 255}, {255, 51, 51}, {255, 51, 51}, {255, 51, 51}, {255, 51, 51}, {0, 255, 0},
+            {0, 255, 0}, {0, 255, 0}, {0, 255, 0}
+        };
+    };
+
+    // PoseResult에 실제로 저장되는 관절 수
+    // - 빌드 용량(POSE_MAX_KEYPOINTS)보다 큰 토폴로지는 시작 시 거부하지만, 컴파일은 되도록 루프 경계를 용량으로 제한
+    template <typename Topology>
+    constexpr int storedJoints() {
+        return Topology::kNumJoints < PoseResult::kMaxKeypoints ? Topology::kNumJoints : PoseResult::kMaxKeypoints;
+    }
+
+    // 설정 이름(pose.topology)의 토폴로지로 visitor(Topology()) 호출 - 알 수 없는 이름이면 false
+    template <typename Visitor>
+    bool visit(const std::string& name, Visitor&& visitor) {
+        if (name == "coco17") {
+            visitor(Coco17());
+        } else if (name == "wholebody133") {
+            visitor(WholeBody133());
+        } else if (name == "hand21") {
+            visitor(Hand21());
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // 관절 수로 토폴로지 선택 (결과만 있는 그리기 경로) - 해당하는 토폴로지가 없으면 false
+    template <typename Visitor>
+    bool visit(int numJoints, Visitor&& visitor) {
+        switch (numJoints) {
+            case Coco17::kNumJoints: visitor(Coco17()); return true;
+            case WholeBody133::kNumJoints: visitor(WholeBody133()); return true;
+            case Hand21::kNumJoints: visitor(Hand21()); return true;
+            default: return false;
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#include "PresenceGate.h"
+#include <cmath>
+
+PresenceGate::PresenceGate(const AppConfig& config)
+    : config(config), gridWidth(0), gridHeight(0), hasPrevious(false), active(true),
+      foregroundRatio(0.0f), motionRatio(0.0f),
+      lastPresentTime(std::chrono::steady_clock::now()),
+      lastHeartbeatTime(std::chrono::steady_clock::now()),
+      lastPersonTime(std::chrono::steady_clock::now()) {
+    // 시작 직후 hold_ms 동안은 활성 상태로 추론하며 배경을 학습하지 않음
+}
+
+bool PresenceGate::shouldInfer(const rs2::depth_frame& depthFrame) {
+    sample(depthFrame);
+
+    // 설정 임계값(mm)을 깊이 단위로 변환
+    float unitsPerMm = 0.001f / depthFrame.get_units();
+    float foregroundThreshold = config.presence.foreground_threshold_mm * unitsPerMm;
+    float motionThreshold = config.presence.motion_threshold_mm * unitsPerMm;
+
+    int validCount = 0;
+    int foregroundCount = 0;
+    int motionCount = 0;
+    for (size_t i = 0; i < current.size(); i++) {
+        uint16_t depth = current[i];
+        if (depth == 0) continue; // 깊이 없음
+        validCount++;
+
+        // 배경보다 가까운 물체만 전경 (배경이 멀어지는 경우는 무시)
+        if (background[i] > 0.0f && background[i] - depth > foregroundThreshold) {
+            foregroundCount++;
+        }
+        if (hasPrevious && previous[i] != 0 &&
+            std::abs(static_cast<int>(depth) - static_cast<int>(previous[i])) > motionThreshold) {
+            motionCount++;
+        }
+    }
+
+    foregroundRatio = validCount > 0 ? static_cast<float>(foregroundCount) / validCount : 0.0f;
+    motionRatio = validCount > 0 ? static_cast<float>(motionCount) / validCount : 0.0f;
+
+    auto now = std::chrono::steady_clock::now();
+    bool present = foregroundRatio > config.presence.foreground_ratio || motionRatio > config.presence.motion_ratio;
+    if (present) {
+        lastPresentTime = now;
+    }
+    active = now - lastPresentTime < std::chrono::milliseconds(config.presence.hold_ms);
+
+    if (!active) {
+        updateBackground();
+        lastPersonTime = now; // 흡수 대기 시간은 활성 상태에서만 셈
+    } else if (config.presence.absorb_ms > 0 &&
+               now - lastPersonTime >= std::chrono::milliseconds(config.presence.absorb_ms)) {
+        // 활성 상태지만 사람이 검출되지 않은 채 absorb_ms가 지남 - 정지 물체로 보고 배경으로 흡수
+        updateBackground();
+    }
+
+    current.swap(previous);
+    hasPrevious = true;
+
+    if (active) {
+        return true;
+    }
+
+    // 비활성 상태: 하트비트 주기로만 추론
+    if (now - lastHeartbeatTime >= std::chrono::milliseconds(config.presence.heartbeat_ms)) {
+        lastHeartbeatTime = now;
+        return true;
+    }
+    return false;
+}
+
+void PresenceGate::reportDetection(int visibleKeypoints) {
+    if (visibleKeypoints >= config.presence.min_keypoints) {
+        lastPresentTime = std::chrono::steady_clock::now();
+        lastPersonTime = lastPresentTime;
+        active = true;
+    }
+}
+
+void PresenceGate::applyConfig(const AppConfig& config) {
+    this->config = config;
+}
+
+bool PresenceGate::isActive() const {
+    return active;
+}
+
+float PresenceGate::getForegroundRatio() const {
+    return foregroundRatio;
+}
+
+float PresenceGate::getMotionRatio() const {
+    return motionRatio;
+}
+
+void PresenceGate::sample(const rs2::depth_frame& depthFrame) {
+    int step = config.presence.decimation > 0 ? config.presence.decimation : 1;
+    int width = depthFrame.get_width();
+    int height = depthFrame.get_height();
+    int newGridWidth = width / step;
+    int newGridHeight = height / step;
+
+    // 해상도가 바뀌면 모델 초기화
+    if (newGridWidth != gridWidth || newGridHeight != gridHeight) {
+        gridWidth = newGridWidth;
+        gridHeight = newGridHeight;
+        current.assign(gridWidth * gridHeight, 0);
+        previous.assign(gridWidth * gridHeight, 0);
+        background.assign(gridWidth * gridHeight, 0.0f);
+        hasPrevious = false;
+    }
+
+    const uint8_t* data = static_cast<const uint8_t*>(depthFrame.get_data());
+    int stride = depthFrame.get_stride_in_bytes();
+    for (int gy = 0; gy < gridHeight; gy++) {
+        const uint16_t* row = reinterpret_cast<const uint16_t*>(data + (gy * step + step / 2) * stride);
+        uint16_t* out = current.data() + gy * gridWidth;
+        for (int gx = 0; gx < gridWidth; gx++) {
+            out[gx] = row[gx * step + step / 2];
+        }
+    }
+}
+
+void PresenceGate::updateBackground() {
+    float alpha = config.presence.background_alpha;
+    for (size_t i = 0; i < current.size(); i++) {
+        uint16_t depth = current[i];
+        if (depth == 0) continue;
+        if (background[i] <= 0.0f) {
+            background[i] = depth;
+        } else {
+            background[i] += alpha * (depth - background[i]);
+        }
+    }
+}
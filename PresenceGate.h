@@ -0,0 +1,59 @@
+#pragma once
+
+#include <librealsense2/rs.hpp>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "ConfigManager.h"
+
+// 깊이 기반 재실 게이트 - 장면이 비었거나 정지해 있으면 포즈 추론을 건너뜀
+// - 원시 Z16 깊이를 decimation 간격으로 샘플링한 저해상도 격자에서 동작 (프레임당 수천 픽셀)
+// - 전경: 학습된 배경 깊이보다 임계값 이상 가까운 픽셀 비율
+// - 움직임: 직전 프레임 대비 깊이 변화가 임계값을 넘는 픽셀 비율
+// - 감지 후 hold_ms 동안은 계속 추론(히스테리시스), 비활성 상태에서도 heartbeat_ms마다 한 번 추론
+// - 활성 상태라도 absorb_ms 동안 사람이 검출되지 않으면 배경 갱신 재개 (옮겨진 가구 등 정지 물체가 게이트를 계속 열지 않도록)
+class PresenceGate {
+public:
+    PresenceGate(const AppConfig& config);
+
+    // 이번 프레임에서 추론을 실행할지 판단 (배경 모델/상태 갱신 포함)
+    bool shouldInfer(const rs2::depth_frame& depthFrame);
+
+    // 추론 결과 피드백 - 충분한 키포인트가 검출되면 정지한 사람도 활성 상태로 유지
+    // (움직이지 않는 사람이 배경으로 학습되는 것을 방지)
+    void reportDetection(int visibleKeypoints);
+
+    // 핫 리로드된 presence 설정 반영 - shouldInfer와 같은 스레드에서 프레임 사이에 호출
+    // (decimation이 바뀌면 다음 프레임에 배경 모델을 새로 학습)
+    void applyConfig(const AppConfig& config);
+
+    // 사람 또는 움직임이 감지된 상태인지 (히스테리시스 포함)
+    bool isActive() const;
+
+    // 마지막 프레임의 전경/움직임 픽셀 비율 (유효 깊이 픽셀 기준)
+    float getForegroundRatio() const;
+    float getMotionRatio() const;
+
+private:
+    AppConfig config; // 설정 복사본 (applyConfig로 갱신)
+
+    int gridWidth;
+    int gridHeight;
+    std::vector<uint16_t> current;  // 이번 프레임 샘플 (깊이 단위)
+    std::vector<uint16_t> previous; // 직전 프레임 샘플
+    std::vector<float> background;  // 배경 깊이 (깊이 단위, 0이면 아직 학습 안 됨)
+
+    bool hasPrevious;
+    bool active;
+    float foregroundRatio;
+    float motionRatio;
+    std::chrono::steady_clock::time_point lastPresentTime;
+    std::chrono::steady_clock::time_point lastHeartbeatTime;
+    std::chrono::steady_clock::time_point lastPersonTime; // 마지막 사람 검출(min_keypoints 이상) 또는 비활성 시각
+
+    // 원시 깊이를 격자로 샘플링
+    void sample(const rs2::depth_frame& depthFrame);
+
+    // 장면이 비어 있거나 사람 없는 전경이 absorb_ms 이상 지속될 때만 배경 갱신 (사람이 배경으로 흡수되지 않도록)
+    void updateBackground();
+};
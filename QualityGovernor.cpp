@@ -0,0 +1,159 @@
+#include "QualityGovernor.h"
+#include <iostream>
+
+namespace {
+    bool sameLevel(const AppConfig::GovernorLevel& a, const AppConfig::GovernorLevel& b) {
+        return a.input_width == b.input_width && a.input_height == b.input_height &&
+               a.depth_visualization == b.depth_visualization && a.inference_interval == b.inference_interval &&
+               a.depth_decimation == b.depth_decimation;
+    }
+}
+
+QualityGovernor::QualityGovernor(const AppConfig& config)
+    : config(config), levelIndex(0), framesSinceChange(0), frameTimes(config.governor.window) {
+    buildLevels();
+}
+
+bool QualityGovernor::applyConfig(const AppConfig& config) {
+    // 단계 목록은 governor.levels와 (기본 단계의 경우) 모델 입력 크기/프로파일에서만 만들어짐
+    bool levelsChanged = config.governor.levels.size() != this->config.governor.levels.size() ||
+                         ConfigManager::modelChanged(this->config, config);
+    for (size_t i = 0; !levelsChanged && i < config.governor.levels.size(); i++) {
+        levelsChanged = !sameLevel(config.governor.levels[i], this->config.governor.levels[i]);
+    }
+    bool windowChanged = config.governor.window != this->config.governor.window;
+    this->config = config;
+
+    // 판단 창 크기가 바뀌면 새 창으로 다시 측정
+    if (windowChanged) {
+        frameTimes = Utils::WindowedStats(config.governor.window);
+        framesSinceChange = 0;
+    }
+    if (!levelsChanged) {
+        return false; // 단계 목록(disableInputResize로 정리된 것 포함)과 현재 단계 유지
+    }
+
+    buildLevels();
+    levelIndex = 0;
+    framesSinceChange = 0;
+    frameTimes.reset();
+    std::cout << "[품질 조절] 단계 목록이 바뀌어 0단계부터 다시 시작합니다 (" << levels.size() << "단계)" << std::endl;
+    return true;
+}
+
+void QualityGovernor::buildLevels() {
+    levels.clear();
+    if (config.governor.levels.empty()) {
+        buildDefaultLevels();
+    } else {
+        levels = config.governor.levels;
+    }
+}
+
+void QualityGovernor::buildDefaultLevels() {
+    AppConfig::GovernorLevel level;
+    level.input_width = config.pose.input_width;
+    level.input_height = config.pose.input_height;
+    level.depth_visualization = true;
+    level.inference_interval = 1;
+    level.depth_decimation = 1;
+    levels.push_back(level);
+
+    // 1) 깊이 시각화(CLAHE/컬러맵) 생략
+    level.depth_visualization = false;
+    levels.push_back(level);
+
+    // 2) 입력 크기를 현재보다 작은 프로파일 중 가장 큰 것으로 (pose.profiles에 없으면 단계 생략)
+    int bestArea = 0;
+    int inputArea = config.pose.input_width * config.pose.input_height;
+    for (const AppConfig::InputProfile& profile : config.pose.profiles) {
+        int area = profile.width * profile.height;
+        if (area < inputArea && area > bestArea) {
+            bestArea = area;
+            level.input_width = profile.width;
+            level.input_height = profile.height;
+        }
+    }
+    if (bestArea > 0) {
+        levels.push_back(level);
+    }
+
+    // 3) 2프레임마다 추론
+    level.inference_interval = 2;
+    levels.push_back(level);
+
+    // 4) 깊이 2배 데시메이션
+    level.depth_decimation = 2;
+    levels.push_back(level);
+}
+
+bool QualityGovernor::update(double frameMs) {
+    frameTimes.add(static_cast<float>(frameMs / 1000.0));
+    framesSinceChange++;
+    if (framesSinceChange < config.governor.cooldown_frames || frameTimes.size() < config.governor.window) {
+        return false;
+    }
+
+    double averageMs = getAverageFrameMs();
+    int previous = levelIndex;
+    if (averageMs > config.governor.target_frame_ms * config.governor.step_down_ratio &&
+        levelIndex + 1 < getLevelCount()) {
+        levelIndex++;
+    } else if (averageMs < config.governor.target_frame_ms * config.governor.step_up_ratio && levelIndex > 0) {
+        levelIndex--;
+    }
+
+    if (levelIndex == previous) {
+        return false;
+    }
+
+    // 새 단계의 시간만으로 다시 판단
+    framesSinceChange = 0;
+    frameTimes.reset();
+    std::cout << "[품질 조절] 평균 " << averageMs << "ms, 목표 " << config.governor.target_frame_ms
+              << "ms → 단계 " << previous << " → " << levelIndex << std::endl;
+    return true;
+}
+
+const AppConfig::GovernorLevel& QualityGovernor::getLevel() const {
+    return levels[levelIndex];
+}
+
+int QualityGovernor::getLevelIndex() const {
+    return levelIndex;
+}
+
+int QualityGovernor::getLevelCount() const {
+    return static_cast<int>(levels.size());
+}
+
+bool QualityGovernor::shouldInfer(uint64_t frameNumber) const {
+    int interval = levels[levelIndex].inference_interval;
+    return interval <= 1 || frameNumber % interval == 0;
+}
+
+double QualityGovernor::getAverageFrameMs() const {
+    return frameTimes.mean() * 1000.0;
+}
+
+void QualityGovernor::disableInputResize() {
+    // 모든 단계의 입력 크기를 0단계 값으로 고정 (나머지 조절 항목은 유지)
+    // - 아무것도 바꾸지 않는 단계가 남으면 단계마다 cooldown만 낭비하므로 제거
+    int width = levels[0].input_width;
+    int height = levels[0].input_height;
+    std::vector<AppConfig::GovernorLevel> kept;
+    int keptIndex = 0;
+    for (size_t i = 0; i < levels.size(); i++) {
+        AppConfig::GovernorLevel level = levels[i];
+        level.input_width = width;
+        level.input_height = height;
+        if (kept.empty() || !sameLevel(kept.back(), level)) {
+            kept.push_back(level);
+        }
+        if (static_cast<int>(i) <= levelIndex) {
+            keptIndex = static_cast<int>(kept.size()) - 1;
+        }
+    }
+    levels.swap(kept);
+    levelIndex = keptIndex;
+}
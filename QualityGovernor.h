@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "ConfigManager.h"
+#include "utils/WindowedStats.h"
+
+// 적응형 품질 조절기 - 최근 프레임 처리 시간이 목표를 넘으면 설정된 단계 목록을 따라 한 단계씩 가볍게,
+// 여유가 생기면 한 단계씩 되돌림 (최대 품질보다 예측 가능한 지연 우선)
+// - 단계 변경 후 cooldown_frames 동안은 판단을 멈춰 진동 방지
+// - 단계 적용(입력 크기, 깊이 시각화, 추론 간격, 데시메이션)은 호출자가 담당
+class QualityGovernor {
+public:
+    QualityGovernor(const AppConfig& config);
+
+    // 프레임 처리 시간(ms) 기록 - 단계가 바뀌었으면 true
+    bool update(double frameMs);
+
+    // 현재 단계 설정
+    const AppConfig::GovernorLevel& getLevel() const;
+    int getLevelIndex() const;
+    int getLevelCount() const;
+
+    // 현재 단계의 추론 간격에 따라 이번 프레임에서 추론할지
+    bool shouldInfer(uint64_t frameNumber) const;
+
+    // 최근 프레임 처리 시간 평균 (ms)
+    double getAverageFrameMs() const;
+
+    // 핫 리로드된 governor/pose 설정 반영 - 목표 시간/비율은 다음 프레임부터 적용
+    // - 단계 목록(governor.levels, 기본 단계의 입력 크기/프로파일)이 바뀌면 다시 만들고 0단계로 돌아감 - 이 경우 true (호출자가 단계 재적용)
+    bool applyConfig(const AppConfig& config);
+
+    // 입력 크기를 바꿀 수 없는 엔진(고정 입력)이면 모든 단계의 입력 크기를 0단계 값으로 고정
+    // - 그 결과 직전 단계와 같아진 단계(입력 크기만 줄이던 단계)는 제거, 현재 단계 번호도 맞춰 조정
+    void disableInputResize();
+
+private:
+    AppConfig config; // 설정 복사본 (applyConfig로 갱신)
+    std::vector<AppConfig::GovernorLevel> levels;
+    int levelIndex;
+    int framesSinceChange;
+    Utils::WindowedStats frameTimes;
+
+    // 설정 단계 목록 또는 pose 설정 기준 기본 단계 생성
+    void buildLevels();
+    void buildDefaultLevels();
+};
@@ -1,11 +1,24 @@
 #include "RealSenseCamera.h"
 #include <iostream>
+#include "utils/ThreadAffinity.h"
 
-RealSenseCamera::RealSenseCamera(const AppConfig& config) : config(config) {
+RealSenseCamera::RealSenseCamera(const AppConfig& config, const AppConfig::CameraConfig* device)
+    : config(config), started(false),
+      latestOnly(config.capture.mode == "latest"),
+      latestQueue(1),
+      receivedCount(0),
+      consumedCount(0),
+      callbackThreadConfigured(false) {
+    if (device) {
+        this->device = *device;
+    } else {
+        this->device.sync_mode = 0;
+    }
 }
 
 RealSenseCamera::~RealSenseCamera() {
     // 파이프라인이 시작된 경우, 정리
+    if (!started) return;
     try {
         pipe.stop();
     } catch (const rs2::error& e) {
@@ -15,34 +28,76 @@ RealSenseCamera::~RealSenseCamera() {
 
 bool RealSenseCamera::start() {
     try {
-        // 설정 파일에서 스트림 포맷 변환
-        rs2_format colorFormat = getColorFormat(config.stream.color.format);
-        rs2_format depthFormat = getDepthFormat(config.stream.depth.format);
-
-        cfg.enable_stream(RS2_STREAM_COLOR, 
-                        config.stream.color.width, 
-                        config.stream.color.height, 
-                        colorFormat, 
-                        config.stream.color.fps);
-        
-        cfg.enable_stream(RS2_STREAM_DEPTH, 
-                        config.stream.depth.width, 
-                        config.stream.depth.height, 
-                        depthFormat, 
-                        config.stream.depth.fps);
+        if (!device.playback_file.empty()) {
+            // 재생 파일: 녹화된 스트림을 그대로 사용 (반복 재생)
+            cfg.enable_device_from_file(device.playback_file, true);
+        } else {
+            if (!device.serial.empty()) {
+                cfg.enable_device(device.serial);
+            }
+            
+            // 설정 파일에서 스트림 포맷 변환
+            rs2_format colorFormat = getColorFormat(config.stream.color.format);
+            rs2_format depthFormat = getDepthFormat(config.stream.depth.format);
+
+            cfg.enable_stream(RS2_STREAM_COLOR, 
+                            config.stream.color.width, 
+                            config.stream.color.height, 
+                            colorFormat, 
+                            config.stream.color.fps);
+            
+            cfg.enable_stream(RS2_STREAM_DEPTH, 
+                            config.stream.depth.width, 
+                            config.stream.depth.height, 
+                            depthFormat, 
+                            config.stream.depth.fps);
+        }
         
         // 파이프라인 시작
-        pipe.start(cfg);
+        rs2::pipeline_profile profile;
+        if (latestOnly) {
+            // 콜백 스레드에서 프레임셋을 용량 1 큐에 넣음 - librealsense 내부 큐에 오래된 프레임이 쌓이지 않음
+            profile = pipe.start(cfg, [this](const rs2::frame& frame) {
+                if (!callbackThreadConfigured) {
+                    callbackThreadConfigured = true;
+                    Utils::ThreadAffinity::applyToCurrentThread("capture", this->config.threads.capture.cpus,
+                                                                this->config.threads.capture.priority);
+                }
+                if (frame.is<rs2::frameset>()) {
+                    receivedCount++;
+                    latestQueue.enqueue(frame);
+                }
+            });
+        } else {
+            profile = pipe.start(cfg);
+        }
+        started = true;
+        
+        if (device.playback_file.empty()) {
+            applySyncMode(profile);
+        }
         return true;
     } catch (const rs2::error& e) {
-        std::cerr << "RealSense 에러 (파이프라인 시작 중): " << e.what() << std::endl;
+        std::cerr << "RealSense 에러 (파이프라인 시작 중, " << getName() << "): " << e.what() << std::endl;
         return false;
     }
 }
 
 bool RealSenseCamera::getFrames(rs2::frameset& frames) {
     try {
-        frames = pipe.wait_for_frames();
+        if (latestOnly) {
+            // 큐에는 항상 가장 최근 프레임셋 하나만 남아 있음
+            rs2::frame frame;
+            if (!latestQueue.try_wait_for_frame(&frame, static_cast<unsigned int>(config.capture.timeout_ms))) {
+                std::cerr << "RealSense 프레임 대기 시간 초과 (" << getName() << ")" << std::endl;
+                return false;
+            }
+            consumedCount++;
+            frames = frame.as<rs2::frameset>();
+            return true;
+        }
+        
+        frames = pipe.wait_for_frames(static_cast<unsigned int>(config.capture.timeout_ms));
         return true;
     } catch (const rs2::error& e) {
         std::cerr << "RealSense 에러 (프레임 대기 중): " << e.what() << std::endl;
@@ -50,10 +105,37 @@ bool RealSenseCamera::getFrames(rs2::frameset& frames) {
     }
 }
 
+std::string RealSenseCamera::getName() const {
+    if (!device.playback_file.empty()) return device.playback_file;
+    if (!device.serial.empty()) return device.serial;
+    return "default";
+}
+
+uint64_t RealSenseCamera::getDroppedCount() const {
+    // 큐에 남아 있는 최대 1개를 제외하고 소비되지 않은 프레임셋은 버려진 것
+    uint64_t received = receivedCount;
+    uint64_t consumed = consumedCount;
+    return received > consumed + 1 ? received - consumed - 1 : 0;
+}
+
+void RealSenseCamera::applySyncMode(const rs2::pipeline_profile& profile) {
+    if (device.sync_mode == 0) return;
+    
+    // 깊이 센서에 카메라 간 하드웨어 동기화 모드 설정 (동기화 케이블 필요)
+    rs2::depth_sensor sensor = profile.get_device().first<rs2::depth_sensor>();
+    if (sensor.supports(RS2_OPTION_INTER_CAM_SYNC_MODE)) {
+        sensor.set_option(RS2_OPTION_INTER_CAM_SYNC_MODE, static_cast<float>(device.sync_mode));
+        std::cout << "카메라 " << getName() << ": 하드웨어 동기화 모드 " << device.sync_mode << std::endl;
+    } else {
+        std::cerr << "카메라 " << getName() << "는 하드웨어 동기화를 지원하지 않습니다." << std::endl;
+    }
+}
+
 rs2_format RealSenseCamera::getColorFormat(const std::string& format) {
     if (format == "RGB8") return RS2_FORMAT_RGB8;
     else if (format == "RGBA8") return RS2_FORMAT_RGBA8;
     else if (format == "BGRA8") return RS2_FORMAT_BGRA8;
+    else if (format == "YUYV") return RS2_FORMAT_YUYV; // 센서 원본 포맷 (librealsense 색 변환 생략)
     else return RS2_FORMAT_BGR8; // 기본값
 }
 
@@ -2,11 +2,14 @@
 
 #include <librealsense2/rs.hpp>
 #include <opencv2/opencv.hpp>
+#include <string>
+#include <atomic>
 #include "ConfigManager.h"
 
 class RealSenseCamera {
 public:
-    RealSenseCamera(const AppConfig& config);
+    // device가 nullptr이면 연결된 첫 번째 장치 사용
+    RealSenseCamera(const AppConfig& config, const AppConfig::CameraConfig* device = nullptr);
     ~RealSenseCamera();
     
     // 카메라 시작
@@ -15,12 +18,30 @@ public:
     // 프레임 가져오기
     bool getFrames(rs2::frameset& frames);
     
+    // 장치 식별 이름 (시리얼 번호 또는 재생 파일)
+    std::string getName() const;
+    
+    // 최신 프레임 모드에서 소비되지 못하고 버려진 프레임셋 수
+    uint64_t getDroppedCount() const;
+    
 private:
     rs2::pipeline pipe;
     rs2::config cfg;
     const AppConfig& config;
+    AppConfig::CameraConfig device;
+    bool started;
+    
+    // 최신 프레임 모드: 용량 1 큐 - 새 프레임셋이 오면 이전 것은 버려짐
+    bool latestOnly;
+    rs2::frame_queue latestQueue;
+    std::atomic<uint64_t> receivedCount;
+    std::atomic<uint64_t> consumedCount;
+    bool callbackThreadConfigured; // 콜백 스레드 CPU 고정은 첫 콜백에서 한 번만 적용
     
     // 포맷 문자열을 rs2_format으로 변환
     rs2_format getColorFormat(const std::string& format);
     rs2_format getDepthFormat(const std::string& format);
-}; 
\ No newline at end of file
+    
+    // 하드웨어 동기화 모드 적용
+    void applySyncMode(const rs2::pipeline_profile& profile);
+};
@@ -3,15 +3,262 @@
 #include <string>
 #include <unistd.h>
 #include <limits.h>
+#include <iomanip>
+#include <chrono>
+#include <future>
+#include <memory>
 #include "ConfigManager.h"
 #include "utils/FileUtils.h"
 #include "DepthProcessor.h"
 #include "utils/FPSCounter.h"
+#include "utils/WindowedStats.h"
 #include "RealSenseCamera.h"
+#include "MultiCameraRig.h"
+#include "PresenceGate.h"
+#include "QualityGovernor.h"
+#include "PointCloudExtractor.h"
 #include "utils/ImageSaver.h"
 #include "utils/KeyboardHandler.h"
 #include "PoseEstimator.h"
-#include "utils/Visualizer.h"
+#include "utils/DisplayThread.h"
+#include "utils/VideoRecorder.h"
+#include "utils/KeypointPublisher.h"
+#include "utils/SharedFrameRing.h"
+#include "utils/Metrics.h"
+#include "utils/MetricsServer.h"
+#include "utils/FrameTiming.h"
+#include "utils/LatencyLogger.h"
+#include "utils/ThreadAffinity.h"
+#include "utils/ColorConversion.h"
+#include "utils/FramePool.h"
+#include "utils/ConfigWatcher.h"
+
+// 파이프라인 메트릭 - 등록은 시작 시 한 번, 루프에서는 참조로 wait-free 기록
+struct PipelineMetrics {
+    Utils::Metrics::Histogram& capture;
+    Utils::Metrics::Histogram& depth;
+    Utils::Metrics::Histogram& preprocess;
+    Utils::Metrics::Histogram& infer;
+    Utils::Metrics::Histogram& postprocess;
+    Utils::Metrics::Histogram& render;
+    Utils::Metrics::Histogram& save;
+    Utils::Metrics::Counter& frames;
+    Utils::Metrics::Counter& captureErrors;
+    Utils::Metrics::Counter& invalidFrames;
+    Utils::Metrics::Counter& publishDropped;
+    Utils::Metrics::Counter& recordDropped;
+    Utils::Metrics::Counter& staleDropped;
+    Utils::Metrics::Counter& inferenceSkipped;
+    Utils::Metrics::Gauge& presenceActive;
+    Utils::Metrics::Gauge& qualityLevel;
+    Utils::Metrics::Histogram& sensorToHost;
+    Utils::Metrics::Histogram& endToEnd;
+    Utils::Metrics::Gauge& fps;
+    Utils::Metrics::Gauge& poolInUse;
+    Utils::Metrics::Gauge& poolIdle;
+    Utils::Metrics::Counter& poolHits;
+    Utils::Metrics::Counter& poolMisses;
+
+    explicit PipelineMetrics(Utils::Metrics::Registry& registry)
+        : capture(registry.histogram("realpose_stage_latency_seconds", "Pipeline stage latency in seconds", "stage=\"capture\"")),
+          depth(registry.histogram("realpose_stage_latency_seconds", "Pipeline stage latency in seconds", "stage=\"depth\"")),
+          preprocess(registry.histogram("realpose_stage_latency_seconds", "Pipeline stage latency in seconds", "stage=\"preprocess\"")),
+          infer(registry.histogram("realpose_stage_latency_seconds", "Pipeline stage latency in seconds", "stage=\"infer\"")),
+          postprocess(registry.histogram("realpose_stage_latency_seconds", "Pipeline stage latency in seconds", "stage=\"postprocess\"")),
+          render(registry.histogram("realpose_stage_latency_seconds", "Pipeline stage latency in seconds", "stage=\"render\"")),
+          save(registry.histogram("realpose_stage_latency_seconds", "Pipeline stage latency in seconds", "stage=\"save\"")),
+          frames(registry.counter("realpose_frames_total", "Frames processed by the pipeline")),
+          captureErrors(registry.counter("realpose_frames_dropped_total", "Frames dropped before processing", "reason=\"capture_error\"")),
+          invalidFrames(registry.counter("realpose_frames_dropped_total", "Frames dropped before processing", "reason=\"invalid_frame\"")),
+          publishDropped(registry.counter("realpose_publish_dropped_total", "Keypoint packets dropped by the non-blocking publisher")),
+          recordDropped(registry.counter("realpose_record_dropped_total", "Frames dropped because the video encoder queue was full")),
+          staleDropped(registry.counter("realpose_frames_dropped_total", "Frames dropped before processing", "reason=\"stale\"")),
+          inferenceSkipped(registry.counter("realpose_inference_skipped_total", "Frames where the presence gate skipped pose inference")),
+          presenceActive(registry.gauge("realpose_presence_active", "1 while the presence gate sees a person or motion")),
+          qualityLevel(registry.gauge("realpose_quality_level", "Current quality governor level (0 = full quality)")),
+          sensorToHost(registry.histogram("realpose_sensor_to_host_seconds", "Latency from sensor timestamp to host arrival in seconds")),
+          endToEnd(registry.histogram("realpose_end_to_end_latency_seconds", "Latency from sensor timestamp to rendered result in seconds")),
+          fps(registry.gauge("realpose_fps", "Moving-average frames per second")),
+          poolInUse(registry.gauge("realpose_frame_pool_buffers", "Frame pool image buffers", "state=\"in_use\"")),
+          poolIdle(registry.gauge("realpose_frame_pool_buffers", "Frame pool image buffers", "state=\"idle\"")),
+          poolHits(registry.counter("realpose_frame_pool_hits_total", "Image buffer requests served from the frame pool")),
+          poolMisses(registry.counter("realpose_frame_pool_misses_total", "Image buffer requests that allocated a new buffer")) {
+    }
+};
+
+// 프레임 지연 구간을 메트릭과 로그에 기록
+void recordLatency(const Utils::FrameTiming& timing, PipelineMetrics& metrics, Utils::LatencyLogger* latencyLogger) {
+    Utils::FrameTiming::Breakdown latency = timing.breakdown();
+    if (latency.sensorToArrivalMs >= 0.0) {
+        metrics.sensorToHost.observe(latency.sensorToArrivalMs / 1000.0);
+    }
+    if (latency.endToEndMs >= 0.0) {
+        metrics.endToEnd.observe(latency.endToEndMs / 1000.0);
+    }
+    if (latencyLogger) {
+        latencyLogger->log(timing);
+    }
+}
+
+// 프레임 버퍼 풀 점유/재사용 메트릭 갱신 (누적 값은 지난 갱신 이후 증가분만 카운터에 반영)
+void recordFramePool(PipelineMetrics& metrics, Utils::FramePool::Stats& reported) {
+    Utils::FramePool::Stats stats = Utils::FramePool::instance().getStats();
+    metrics.poolInUse.set(static_cast<double>(stats.inUse));
+    metrics.poolIdle.set(static_cast<double>(stats.idle));
+    metrics.poolHits.increment(stats.hits - reported.hits);
+    metrics.poolMisses.increment(stats.misses - reported.misses);
+    reported = stats;
+}
+
+// 품질 조절 단계 적용 (모델 입력 크기, 깊이 데시메이션 배율)
+// - 깊이 시각화/추론 간격은 메인 루프에서 프레임마다 확인
+void applyGovernorLevel(QualityGovernor& governor, PoseEstimator& poseEstimator, rs2::decimation_filter& decimationFilter) {
+    if (!poseEstimator.setInputResolution(governor.getLevel().input_width, governor.getLevel().input_height)) {
+        std::cerr << "준비된 해상도 프로파일(pose.profiles)에 없는 입력 크기입니다. 품질 조절에서 입력 크기 단계를 제외합니다." << std::endl;
+        governor.disableInputResize(); // 단계 목록이 바뀜 - 아래에서 현재 단계를 다시 읽음
+        poseEstimator.setInputResolution(governor.getLevel().input_width, governor.getLevel().input_height);
+    }
+    const AppConfig::GovernorLevel& level = governor.getLevel();
+    if (level.depth_decimation > 1) {
+        decimationFilter.set_option(RS2_OPTION_FILTER_MAGNITUDE, static_cast<float>(level.depth_decimation));
+    }
+}
+
+// 모델 재로드 - 새 PoseEstimator는 작업 스레드에서 만들고 처리 스레드는 프레임 경계에서 포인터만 교체
+// - 생성하는 동안(수 초) 캡처/추론은 기존 엔진으로 계속, 기존 엔진은 교체 직후 해제
+// - 생성 중에 모델 설정이 다시 바뀌면 끝난 결과를 버리고 최신 설정으로 다시 생성
+class PoseEstimatorReloader {
+public:
+    explicit PoseEstimatorReloader(const AppConfig& config) : target(std::make_shared<const AppConfig>(config)) {}
+    
+    ~PoseEstimatorReloader() {
+        if (building.valid()) {
+            building.wait();
+        }
+    }
+    
+    // 모델 항목이 마지막 요청과 다르면 새 추정기 생성 요청 (진행 중인 생성이 있으면 끝난 뒤 시작)
+    void request(const std::shared_ptr<const AppConfig>& config) {
+        if (!ConfigManager::modelChanged(*target, *config)) {
+            return;
+        }
+        target = config;
+        if (!building.valid()) {
+            startBuild();
+        }
+    }
+    
+    // 생성 중인 추정기가 있는지
+    bool isPending() const {
+        return building.valid();
+    }
+    
+    // 생성이 끝났으면 estimator와 교체 (live의 모델 외 설정 적용) - 교체했으면 true
+    bool poll(std::unique_ptr<PoseEstimator>& estimator, const AppConfig& live) {
+        if (!building.valid() || building.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+        std::unique_ptr<PoseEstimator> rebuilt = building.get();
+        if (ConfigManager::modelChanged(*buildingConfig, *target)) {
+            startBuild();
+            return false;
+        }
+        if (!rebuilt->isInitialized()) {
+            std::cerr << "새 모델을 불러오지 못했습니다. 기존 모델로 계속합니다." << std::endl;
+            return false;
+        }
+        rebuilt->applyConfig(live);
+        estimator = std::move(rebuilt);
+        std::cout << "새 포즈 추정기로 교체했습니다." << std::endl;
+        return true;
+    }
+    
+private:
+    void startBuild() {
+        std::cout << "모델 설정이 바뀌어 포즈 추정기를 백그라운드에서 다시 만듭니다." << std::endl;
+        buildingConfig = target;
+        std::shared_ptr<const AppConfig> config = target;
+        building = std::async(std::launch::async, [config]() {
+            // 처리 스레드의 CPU 고정/SCHED_FIFO를 상속하므로 엔진 역직렬화/CUDA 할당이 실시간 루프와 같은 코어를 다투지 않도록 해제
+            Utils::ThreadAffinity::resetCurrentThread("pose-rebuild");
+            return std::unique_ptr<PoseEstimator>(new PoseEstimator(*config));
+        });
+    }
+    
+    std::shared_ptr<const AppConfig> target;         // 마지막으로 요청된 모델 설정
+    std::shared_ptr<const AppConfig> buildingConfig; // 생성 중인 추정기의 설정
+    std::future<std::unique_ptr<PoseEstimator>> building;
+};
+
+// 설정 핫 리로드 - 감시자가 새 스냅샷을 냈을 때만 프레임 경계에서 처리 스레드 단계에 적용 (평소에는 버전 비교 한 번)
+// - 깊이 범위/CLAHE/시각화: 호출자가 live 스냅샷으로 다음 프레임부터 사용 (녹화/재실 게이트/품질 조절/점군은 applyConfig)
+// - 신뢰도 임계값/전처리 정규화: 엔진 유지 (PoseEstimator::applyConfig)
+// - 모델 관련 항목: reloader가 백그라운드에서 새 PoseEstimator를 만들고 성공하면 poll에서 교체 (실패하면 기존 엔진으로 계속)
+// - 저장 경로: 새 ImageSaver로 교체 (새 세션 디렉토리, 실패하면 기존 세션 유지)
+// 반환: 새 스냅샷을 적용했는지 (호출자가 live를 다른 단계에 전달)
+bool applyConfigUpdate(const Utils::ConfigWatcher* watcher, uint64_t& appliedVersion,
+                       std::shared_ptr<const AppConfig>& live, PoseEstimator& poseEstimator,
+                       PoseEstimatorReloader& reloader, std::unique_ptr<Utils::ImageSaver>& imageSaver) {
+    if (!watcher || watcher->getVersion() == appliedVersion) {
+        return false;
+    }
+    appliedVersion = watcher->getVersion();
+    std::shared_ptr<const AppConfig> next = watcher->snapshot();
+    
+    // 모델이 바뀌었으면 현재 엔진은 그대로 두고 (모델 외 설정은 교체 시 적용) 백그라운드 생성 요청
+    if (!poseEstimator.applyConfig(*next)) {
+        reloader.request(next);
+    }
+    
+    if (next->save.directory != live->save.directory || next->save.session != live->save.session ||
+        next->save.shard_size != live->save.shard_size) {
+        std::unique_ptr<Utils::ImageSaver> saver(new Utils::ImageSaver(next->save.directory, next->save.session,
+                                                                       next->save.shard_size));
+        if (saver->prepareFolder()) {
+            imageSaver = std::move(saver);
+            std::cout << "저장 위치 변경: " << imageSaver->getSessionDirectory() << std::endl;
+        } else {
+            std::cerr << "새 저장 위치를 준비하지 못했습니다. 기존 세션에 계속 저장합니다." << std::endl;
+        }
+    }
+    
+    live = next;
+    return true;
+}
+
+// 저장한 캡처 옆에 사람별 점군을 PLY로 기록 (<캡처 접두사>person<N>.ply)
+void savePersonClouds(PointCloudExtractor& extractor, const rs2::depth_frame& depthFrame, const PoseResult& result,
+                      const std::string& capturePrefix, std::vector<PointCloudExtractor::Point>& cloud) {
+    if (capturePrefix.empty()) return;
+    for (int p = 0; p < result.numPersons; p++) {
+        if (extractor.extractPerson(depthFrame, result, p, cloud) == 0) continue;
+        std::string path = capturePrefix + "person" + std::to_string(p) + ".ply";
+        if (PointCloudExtractor::writePly(path, cloud)) {
+            std::cout << "점군이 저장되었습니다: " << path << " (" << cloud.size() << "점)" << std::endl;
+        }
+    }
+}
+
+// 컬러 프레임을 복사 없이 래핑 - YUYV는 2채널 원본 그대로 (추론 전처리에서 변환, 표시/저장 시에만 BGR 변환)
+cv::Mat wrapColorFrame(const rs2::video_frame& colorFrame) {
+    int type = colorFrame.get_profile().format() == RS2_FORMAT_YUYV ? CV_8UC2 : CV_8UC3;
+    return cv::Mat(cv::Size(colorFrame.get_width(), colorFrame.get_height()),
+                   type, (void*)colorFrame.get_data(), cv::Mat::AUTO_STEP);
+}
+
+// 표시 스레드 시작 및 키 입력 연결 (헤드리스 모드에서는 nullptr)
+// - 표시 스레드가 창 이벤트와 키 입력을 처리하므로 메인 루프의 waitKey는 대기 없이 키만 가져옴
+std::unique_ptr<Utils::DisplayThread> startDisplay(const AppConfig& config, Utils::KeyboardHandler& keyboard) {
+    std::unique_ptr<Utils::DisplayThread> display;
+    if (config.runtime.headless) {
+        return display;
+    }
+    display.reset(new Utils::DisplayThread(config));
+    Utils::DisplayThread* source = display.get();
+    keyboard.setKeySource([source]() { return source->takeKey(); });
+    display->start();
+    return display;
+}
 
 // 소스 디렉토리 경로 얻기
 std::string getSourceDirectory() {
@@ -22,6 +269,249 @@ std::string getSourceDirectory() {
     return ".";
 }
 
+// 다중 카메라 실행 루프
+// - 장치별 캡처 스레드가 최신 프레임을 유지하고, 타임스탬프로 묶인 멀티뷰 프레임셋을 한 번에 추론
+// - 모델은 하나만 로드하여 모든 카메라가 공유
+int runMultiCamera(const AppConfig& config, std::unique_ptr<PoseEstimator>& poseEstimator,
+                   std::unique_ptr<Utils::ImageSaver>& imageSaver, Utils::ConfigWatcher* configWatcher,
+                   PipelineMetrics& metrics, Utils::KeypointPublisher* publisher, Utils::LatencyLogger* latencyLogger) {
+    MultiCameraRig rig(config);
+    if (!rig.start()) {
+        std::cerr << "다중 카메라 시작 실패" << std::endl;
+        return EXIT_FAILURE;
+    }
+    
+    bool headless = config.runtime.headless;
+    std::cout << rig.getCameraCount() << "대의 카메라로 실행합니다. "
+              << (headless ? "'q' + Enter 또는 Ctrl+C로 종료합니다." : "'s'로 저장, 'q'로 종료합니다.") << std::endl;
+    
+    Utils::FPSCounter fpsCounter;
+    Utils::KeyboardHandler keyboard(headless);
+    std::unique_ptr<Utils::DisplayThread> display = startDisplay(config, keyboard);
+    
+    // 카메라별 동영상 녹화 (파일 이름에 카메라 번호)
+    std::vector<std::unique_ptr<Utils::VideoRecorder>> recorders;
+    if (config.record.enabled) {
+        for (size_t i = 0; i < rig.getCameraCount(); i++) {
+            std::unique_ptr<Utils::VideoRecorder> recorder(new Utils::VideoRecorder(config, "cam" + std::to_string(i)));
+            if (recorder->start()) {
+                recorders.push_back(std::move(recorder));
+            }
+        }
+    }
+    
+    // 프레임 간 재사용 버퍼
+    MultiCameraRig::MultiViewFrameset frameset;
+    std::vector<cv::Mat> colorImages;
+    std::vector<Utils::DisplayThread::View> displayViews;
+    std::vector<cv::Mat> depthImages;
+    std::vector<float> centerDistances;
+    std::vector<DepthStatistics> depthStats;
+    std::vector<PoseResult> poseResults;
+    PointCloudExtractor cloudExtractor(config);
+    std::vector<PointCloudExtractor::Point> cloud;
+    uint64_t frameNumber = 0;
+    auto lastStatusTime = std::chrono::steady_clock::now();
+    Utils::FramePool::Stats reportedPool = Utils::FramePool::instance().getStats();
+    
+    // 카메라별 재실 게이트 - 한 뷰라도 활성이면 전체 배치 추론
+    std::vector<std::unique_ptr<PresenceGate>> presenceGates;
+    if (config.presence.enabled) {
+        for (size_t i = 0; i < rig.getCameraCount(); i++) {
+            presenceGates.emplace_back(new PresenceGate(config));
+        }
+    }
+    
+    // 메인 처리 스레드 CPU 고정 - 시작 시 만드는 스레드가 이 설정을 상속하지 않도록 그 뒤에 적용
+    // (이후 모델 재생성 스레드는 PoseEstimatorReloader에서 스스로 해제)
+    Utils::ThreadAffinity::applyToCurrentThread("processing", config.threads.processing.cpus,
+                                                config.threads.processing.priority);
+    
+    // 그룹 지연은 가장 먼저 노출된 첫 번째 뷰 기준
+    Utils::FrameTiming timing;
+    Utils::FrameTiming::Breakdown lastLatency = timing.breakdown();
+    
+    // 핫 리로드 대상 설정 (프레임 경계에서만 교체)
+    std::shared_ptr<const AppConfig> live = std::make_shared<const AppConfig>(config);
+    uint64_t appliedConfigVersion = 0;
+    
+    PoseEstimatorReloader reloader(config);
+    
+    while (!keyboard.isQuitPressed()) {
+        if (applyConfigUpdate(configWatcher, appliedConfigVersion, live, *poseEstimator, reloader, imageSaver)) {
+            for (auto& recorder : recorders) {
+                recorder->applyConfig(live);
+            }
+            for (auto& gate : presenceGates) {
+                gate->applyConfig(*live);
+            }
+            cloudExtractor.applyConfig(*live);
+        }
+        reloader.poll(poseEstimator, *live);
+        
+        fpsCounter.update();
+        Utils::FPSCounter::Stats frameStats = fpsCounter.getStats();
+        metrics.fps.set(frameStats.fps);
+        recordFramePool(metrics, reportedPool);
+        
+        bool captured;
+        {
+            Utils::Metrics::ScopedTimer timer(metrics.capture);
+            captured = rig.getFrameset(frameset);
+        }
+        if (!captured) {
+            metrics.captureErrors.increment();
+            keyboard.waitKey(1);
+            continue;
+        }
+        
+        size_t viewCount = frameset.views.size();
+        timing.begin(frameNumber + 1, frameset.views[0].frames);
+        colorImages.resize(viewCount);
+        depthImages.resize(viewCount);
+        centerDistances.resize(viewCount);
+        depthStats.resize(viewCount);
+        
+        // 뷰별 컬러 래핑 및 깊이 처리 (깊이 시각화는 화면에 표시할 프레임에서만)
+        bool showThisFrame = display && display->wantsFrame();
+        bool valid = true;
+        {
+            Utils::Metrics::ScopedTimer timer(metrics.depth);
+            for (size_t i = 0; i < viewCount && valid; i++) {
+                rs2::depth_frame depthFrame = frameset.views[i].frames.get_depth_frame();
+                rs2::video_frame colorFrame = frameset.views[i].frames.get_color_frame();
+                if (!depthFrame || !colorFrame) {
+                    valid = false;
+                    break;
+                }
+                colorImages[i] = wrapColorFrame(colorFrame);
+                depthImages[i] = showThisFrame ? DepthProcessor::enhancedDepthVisualization(depthFrame, *live) : cv::Mat();
+                depthStats[i].compute(depthFrame, live->depth_range.max);
+                centerDistances[i] = DepthProcessor::calculateCenterDistance(depthStats[i]);
+            }
+        }
+        if (!valid) {
+            std::cerr << "유효하지 않은 프레임 발견. 건너뜁니다." << std::endl;
+            metrics.invalidFrames.increment();
+            continue;
+        }
+        timing.markDepthDone();
+        
+        // 재실 게이트: 모든 뷰가 비어 있거나 정지해 있으면 추론 생략 (모든 게이트의 배경 모델은 갱신)
+        bool runInference = presenceGates.empty();
+        bool anyActive = presenceGates.empty();
+        for (size_t i = 0; i < presenceGates.size() && i < viewCount; i++) {
+            if (presenceGates[i]->shouldInfer(frameset.views[i].frames.get_depth_frame())) {
+                runInference = true;
+            }
+            anyActive = anyActive || presenceGates[i]->isActive();
+        }
+        metrics.presenceActive.set(anyActive ? 1.0 : 0.0);
+        
+        // 멀티뷰 배치 추론
+        bool success = false;
+        if (runInference) {
+            success = poseEstimator->detectBatch(colorImages, poseResults);
+        } else {
+            metrics.inferenceSkipped.increment();
+        }
+        timing.markPoseDone();
+        frameNumber++;
+        metrics.frames.increment();
+        if (!success) {
+            // 실패 시 빈 결과로 표시
+            poseResults.resize(viewCount);
+            for (size_t i = 0; i < viewCount; i++) {
+                poseResults[i].reset(frameNumber, 0, colorImages[i].cols, colorImages[i].rows, 0.0f);
+            }
+        }
+        for (size_t i = 0; i < viewCount; i++) {
+            poseResults[i].frameNumber = frameNumber;
+            if (success && i < presenceGates.size()) {
+                presenceGates[i]->reportDetection(poseResults[i].countVisible());
+            }
+        }
+        if (success) {
+            const PoseEstimator::StageTimings& timings = poseEstimator->getLastTimings();
+            metrics.preprocess.observe(timings.preprocessMs / 1000.0);
+            metrics.infer.observe(timings.inferenceMs / 1000.0);
+            metrics.postprocess.observe(timings.postprocessMs / 1000.0);
+        }
+        
+        // 카메라별 키포인트 발행
+        if (publisher && success) {
+            for (size_t i = 0; i < viewCount; i++) {
+                if (config.publish.include_3d) {
+                    DepthProcessor::deprojectKeypoints(frameset.views[i].frames.get_depth_frame(), poseResults[i]);
+                }
+                if (!publisher->publish(frameNumber, poseResults[i], config.publish.include_3d, static_cast<uint16_t>(i))) {
+                    metrics.publishDropped.increment();
+                }
+            }
+        }
+        
+        // 카메라별 녹화 (인코더 큐에 복사만 하고 바로 반환)
+        for (size_t i = 0; i < recorders.size() && i < viewCount; i++) {
+            if (recorders[i]->wantsFrame() &&
+                !recorders[i]->submit(colorImages[i], frameset.views[i].frames.get_depth_frame(), poseResults[i],
+                                      frameStats, centerDistances[i], &lastLatency)) {
+                metrics.recordDropped.increment();
+            }
+        }
+        
+        if (showThisFrame) {
+            // 그리기/표시는 표시 스레드에서 (여기서는 프레임 전달만)
+            Utils::Metrics::ScopedTimer timer(metrics.render);
+            displayViews.resize(viewCount);
+            for (size_t i = 0; i < viewCount; i++) {
+                displayViews[i].color = colorImages[i];
+                displayViews[i].depth = depthImages[i];
+                displayViews[i].pose = &poseResults[i];
+                displayViews[i].centerDist = centerDistances[i];
+            }
+            display->submit(displayViews, frameStats, &lastLatency, live->depth_range.min, live->depth_range.max);
+        }
+        timing.markRenderDone();
+        recordLatency(timing, metrics, latencyLogger);
+        lastLatency = timing.breakdown();
+        
+        if (headless) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastStatusTime >= std::chrono::seconds(config.runtime.status_interval_sec)) {
+                lastStatusTime = now;
+                std::cout << "[상태] group " << frameset.groupNumber << ", FPS " << std::fixed << std::setprecision(1) << frameStats.fps
+                          << ", 프레임 p50/p99/max " << frameStats.p50Ms << "/" << frameStats.p99Ms << "/" << frameStats.maxMs << "ms"
+                          << ", 뷰 간 시간차 " << frameset.spreadMs << "ms, 버려진 프레임 " << rig.getDroppedCount()
+                          << (anyActive ? "" : ", 유휴 (추론 생략)") << std::endl;
+            }
+        }
+        
+        keyboard.waitKey(1);
+        
+        // 's' 키: 카메라별로 결과 폴더 저장
+        if (keyboard.isSavePressed()) {
+            Utils::Metrics::ScopedTimer timer(metrics.save);
+            for (size_t i = 0; i < viewCount; i++) {
+                rs2::depth_frame depthFrame = frameset.views[i].frames.get_depth_frame();
+                if (depthImages[i].empty()) {
+                    depthImages[i] = DepthProcessor::enhancedDepthVisualization(depthFrame, *live);
+                }
+                cv::Mat saveImage = Utils::ColorConversion::toBgr(colorImages[i]);
+                if (imageSaver->saveImages(saveImage, depthImages[i], depthFrame) && live->pointcloud.save_ply) {
+                    savePersonClouds(cloudExtractor, depthFrame, poseResults[i], imageSaver->getLastCapturePrefix(), cloud);
+                }
+            }
+        }
+    }
+    
+    rig.stop();
+    recorders.clear();
+    if (display) {
+        display->stop();
+    }
+    return EXIT_SUCCESS;
+}
+
 int main(int argc, char *argv[]) try
 {
     // 소스 디렉토리의 config.yaml 직접 로드
@@ -32,7 +522,7 @@ int main(int argc, char *argv[]) try
     
     // 설정 로드
     AppConfig config;
-    if (!ConfigManager::loadConfig(configFile, config)) {
+    if (!ConfigManager::loadConfig(configFile, config) || !ConfigManager::validateConfig(config)) {
         std::cerr << "기본 설정을 사용합니다." << std::endl;
         ConfigManager::setDefaultConfig(config);
     }
@@ -40,87 +530,408 @@ int main(int argc, char *argv[]) try
     // 설정 정보 출력
     ConfigManager::printConfig(config);
     
-    // TensorRT 포즈 추정 모델 로드 (Config에서 경로 사용)
-    PoseEstimator poseEstimator(config);
+    // 프로세스 메모리 고정 (권한이 없으면 경고 후 계속)
+    if (config.threads.lock_memory) {
+        Utils::ThreadAffinity::lockMemory();
+    }
+    
+    // 설정 파일 변경 감시 (실패 시 핫 리로드 없이 계속)
+    std::unique_ptr<Utils::ConfigWatcher> configWatcher;
+    if (config.runtime.hot_reload) {
+        configWatcher.reset(new Utils::ConfigWatcher(configFile, config));
+        if (!configWatcher->start()) {
+            configWatcher.reset();
+        }
+    }
+    
+    // TensorRT 포즈 추정 모델 로드 (Config에서 경로 사용, 핫 리로드로 모델이 바뀌면 교체)
+    std::unique_ptr<PoseEstimator> poseEstimator(new PoseEstimator(config));
     
-    // 이미지 저장기 초기화
-    Utils::ImageSaver imageSaver(config.save.directory);
-    if (!imageSaver.prepareFolder()) {
+    // 이미지 저장기 초기화 (핫 리로드로 저장 경로가 바뀌면 교체)
+    std::unique_ptr<Utils::ImageSaver> imageSaver(
+        new Utils::ImageSaver(config.save.directory, config.save.session, config.save.shard_size));
+    if (!imageSaver->prepareFolder()) {
         return EXIT_FAILURE;
     }
     
-    // RealSense 카메라 초기화
-    RealSenseCamera camera(config);
+    // 메트릭 등록 및 엔드포인트 시작
+    PipelineMetrics metrics(Utils::Metrics::Registry::instance());
+    std::unique_ptr<Utils::MetricsServer> metricsServer;
+    if (config.metrics.enabled) {
+        metricsServer.reset(new Utils::MetricsServer(config.metrics.bind_address, config.metrics.port));
+        if (!metricsServer->start()) {
+            std::cerr << "메트릭 엔드포인트를 비활성화합니다." << std::endl;
+            metricsServer.reset();
+        }
+    }
+    
+    // 키포인트 발행기 초기화
+    std::unique_ptr<Utils::KeypointPublisher> publisher;
+    if (config.publish.enabled) {
+        publisher.reset(new Utils::KeypointPublisher(config.publish.socket_path));
+        if (!publisher->open()) {
+            std::cerr << "키포인트 발행을 비활성화합니다." << std::endl;
+            publisher.reset();
+        }
+    }
+    
+    // 프레임별 지연 로그 초기화
+    std::unique_ptr<Utils::LatencyLogger> latencyLogger;
+    if (config.latency.log_enabled) {
+        latencyLogger.reset(new Utils::LatencyLogger(config.latency.log_path, config.latency.log_format));
+        if (!latencyLogger->open()) {
+            latencyLogger.reset();
+        }
+    }
+    
+    // 카메라가 2대 이상이면 다중 카메라 루프 실행
+    if (config.cameras.size() > 1) {
+        return runMultiCamera(config, poseEstimator, imageSaver, configWatcher.get(), metrics, publisher.get(),
+                              latencyLogger.get());
+    }
+    
+    // RealSense 카메라 초기화 (장치 목록이 있으면 첫 번째 장치 사용)
+    RealSenseCamera camera(config, config.cameras.empty() ? nullptr : &config.cameras[0]);
     if (!camera.start()) {
         std::cerr << "RealSense 카메라 시작 실패" << std::endl;
         return EXIT_FAILURE;
     }
     
-    std::cout << "RealSense 카메라 시작됨. 's'를 누르면 이미지와 깊이 맵을 저장하고, 'q'를 누르면 종료합니다." << std::endl;
-    std::cout << "파일은 " << config.save.directory << "resultN/ 디렉토리에 저장됩니다." << std::endl;
+    bool headless = config.runtime.headless;
+    
+    if (headless) {
+        std::cout << "RealSense 카메라 시작됨 (헤드리스 모드). 's' + Enter로 저장, 'q' + Enter 또는 Ctrl+C로 종료합니다." << std::endl;
+    } else {
+        std::cout << "RealSense 카메라 시작됨. 's'를 누르면 이미지와 깊이 맵을 저장하고, 'q'를 누르면 종료합니다." << std::endl;
+    }
+    std::cout << "파일은 " << imageSaver->getSessionDirectory() << " 디렉토리에 저장됩니다." << std::endl;
     
     // FPS 카운터 초기화
     Utils::FPSCounter fpsCounter;
     
-    // 키보드 핸들러 초기화
-    Utils::KeyboardHandler keyboard;
+    // 추론 단계 지연 추적 (헤드리스 상태 로그의 꼬리 지연 표시용, 약 10초 윈도우)
+    Utils::WindowedStats inferenceTimes(300);
+    
+    // 센서→결과 지연 추적 (프레임 메타데이터 타임스탬프 기준)
+    Utils::FrameTiming timing;
+    Utils::FrameTiming::Breakdown lastLatency = timing.breakdown();
+    Utils::WindowedStats endToEndLatency(300);
+    uint64_t reportedStaleDrops = 0;
+    Utils::FramePool::Stats reportedPool = Utils::FramePool::instance().getStats();
+    
+    // 키보드 핸들러 초기화 (헤드리스 모드에서는 표준 입력/시그널 사용)
+    Utils::KeyboardHandler keyboard(headless);
+    
+    // 표시 스레드 시작 (헤드리스 모드에서는 생략)
+    std::unique_ptr<Utils::DisplayThread> display = startDisplay(config, keyboard);
+    if (display) {
+        std::cout << "'s'를 눌러서 저장하고, 'q'를 눌러서 종료하세요." << std::endl;
+    }
+    
+    // 동영상 녹화 (인코더 스레드 시작 실패 시 녹화 없이 계속)
+    std::unique_ptr<Utils::VideoRecorder> recorder;
+    if (config.record.enabled) {
+        recorder.reset(new Utils::VideoRecorder(config));
+        if (!recorder->start()) {
+            recorder.reset();
+        }
+    }
+    
+    // 재실 게이트 (빈/정지 장면에서 추론 생략)
+    std::unique_ptr<PresenceGate> presenceGate;
+    if (config.presence.enabled) {
+        presenceGate.reset(new PresenceGate(config));
+    }
+    
+    // 품질 조절기 (목표 프레임 시간을 넘으면 단계적으로 품질을 낮춤)
+    std::unique_ptr<QualityGovernor> governor;
+    rs2::decimation_filter decimationFilter;
+    if (config.governor.enabled) {
+        governor.reset(new QualityGovernor(config));
+        applyGovernorLevel(*governor, *poseEstimator, decimationFilter);
+    }
+    cv::Mat lastEnhancedDepth; // 깊이 시각화를 생략하는 단계에서 표시할 직전 이미지
+    
+    // 공유 메모리 프레임 링 (프레임 크기를 알게 되는 첫 프레임에서 생성)
+    std::unique_ptr<Utils::SharedFrameRing::Writer> frameRing;
+    if (config.shared_memory.enabled) {
+        frameRing.reset(new Utils::SharedFrameRing::Writer(config.shared_memory.name, config.shared_memory.slots));
+    }
+    
+    // 프레임 간 재사용 버퍼
+    PoseResult poseResult;
+    DepthStatistics depthStats;
+    PointCloudExtractor cloudExtractor(config);
+    std::vector<PointCloudExtractor::Point> cloud;
+    std::vector<Utils::DisplayThread::View> displayViews(1);
+    std::vector<Utils::KeypointProtocol::Point2D> ringKeypoints2d;
+    std::vector<Utils::KeypointProtocol::Point3D> ringKeypoints3d;
+    uint64_t frameNumber = 0;
+    auto lastStatusTime = std::chrono::steady_clock::now();
+    
+    // 핫 리로드 대상 설정 (프레임 경계에서만 교체)
+    std::shared_ptr<const AppConfig> live = std::make_shared<const AppConfig>(config);
+    uint64_t appliedConfigVersion = 0;
     
-    // 시각화 창 생성 - Visualizer 사용
-    Utils::Visualizer::initializeWindows();
+    // 메인 처리 스레드 CPU 고정 - 카메라/작업자 스레드가 이 설정을 상속하지 않도록 시작 시 스레드 생성 후 적용
+    // (이후 모델 재생성 스레드는 PoseEstimatorReloader에서 스스로 해제)
+    Utils::ThreadAffinity::applyToCurrentThread("processing", config.threads.processing.cpus,
+                                                config.threads.processing.priority);
     
-    std::cout << "'s'를 눌러서 저장하고, 'q'를 눌러서 종료하세요." << std::endl;
+    PoseEstimatorReloader reloader(config);
     
     // 메인 루프
     while(!keyboard.isQuitPressed()) {
+        // 설정 파일이 바뀌었으면 이번 프레임부터 적용
+        if (applyConfigUpdate(configWatcher.get(), appliedConfigVersion, live, *poseEstimator, reloader, imageSaver)) {
+            if (recorder) {
+                recorder->applyConfig(live);
+            }
+            if (presenceGate) {
+                presenceGate->applyConfig(*live);
+            }
+            cloudExtractor.applyConfig(*live);
+            // 모델 교체를 기다리는 중이면 단계 적용은 교체 시점에 (기존 엔진 기준으로 입력 크기 단계를 제외하지 않도록)
+            if (governor && governor->applyConfig(*live) && !reloader.isPending()) {
+                applyGovernorLevel(*governor, *poseEstimator, decimationFilter);
+            }
+        }
+        // 백그라운드에서 만든 포즈 추정기로 교체되면 현재 품질 단계 입력 크기 적용
+        if (reloader.poll(poseEstimator, *live) && governor) {
+            applyGovernorLevel(*governor, *poseEstimator, decimationFilter);
+        }
+        
         // FPS 업데이트
-        float fps = fpsCounter.update();
+        fpsCounter.update();
+        Utils::FPSCounter::Stats frameStats = fpsCounter.getStats();
+        metrics.fps.set(frameStats.fps);
         
         // 프레임 가져오기
         rs2::frameset frames;
-        if(!camera.getFrames(frames)) {
+        bool captured;
+        {
+            Utils::Metrics::ScopedTimer timer(metrics.capture);
+            captured = camera.getFrames(frames);
+        }
+        if(!captured) {
+            metrics.captureErrors.increment();
             continue;
         }
         
         // 프레임셋에서 깊이 및 컬러 프레임 추출
         rs2::depth_frame depthFrame = frames.get_depth_frame();
         rs2::video_frame colorFrame = frames.get_color_frame();
+        timing.begin(frameNumber + 1, frames);
         
         if (!depthFrame || !colorFrame) {
             std::cerr << "유효하지 않은 프레임 발견. 건너뜁니다." << std::endl;
+            metrics.invalidFrames.increment();
             continue;
         }
         
-        // 컬러 이미지를 OpenCV 형식으로 변환
-        cv::Mat colorImage(cv::Size(colorFrame.get_width(), colorFrame.get_height()), 
-                           CV_8UC3, (void*)colorFrame.get_data(), cv::Mat::AUTO_STEP);
+        // 컬러 이미지를 OpenCV 형식으로 래핑 (YUYV는 변환 없이)
+        cv::Mat colorImage = wrapColorFrame(colorFrame);
+        
+        // 품질 조절 단계의 깊이 데시메이션 (이후 깊이 처리/3D 변환 모두 축소된 프레임 사용)
+        // - 공유 메모리 링은 생성 시 해상도로 고정이므로 원본 프레임을 따로 유지해 발행
+        rs2::depth_frame sensorDepthFrame = depthFrame;
+        if (governor && governor->getLevel().depth_decimation > 1) {
+            depthFrame = decimationFilter.process(depthFrame).as<rs2::depth_frame>();
+        }
+        
+        // 깊이 맵 시각화 (화면에 표시할 프레임에서만 생성 - 헤드리스 모드에서는 저장 시에만, 품질 조절 단계에 따라 생략 가능)
+        bool showThisFrame = display && display->wantsFrame();
+        cv::Mat enhancedDepth;
+        bool depthVisualized = false;
+        float centerDist;
+        {
+            Utils::Metrics::ScopedTimer timer(metrics.depth);
+            if (showThisFrame && (!governor || governor->getLevel().depth_visualization)) {
+                enhancedDepth = DepthProcessor::enhancedDepthVisualization(depthFrame, *live);
+                lastEnhancedDepth = enhancedDepth;
+                depthVisualized = true;
+            }
+            
+            // 프레임 깊이 통계(적분 영상) 한 번 계산 후 중앙 거리 등 영역 조회는 O(1)
+            depthStats.compute(depthFrame, live->depth_range.max);
+            centerDist = DepthProcessor::calculateCenterDistance(depthStats);
+        }
+        timing.markDepthDone();
         
-        // 깊이 맵 시각화
-        cv::Mat enhancedDepth = DepthProcessor::enhancedDepthVisualization(depthFrame, config);
+        // 재실 게이트: 빈/정지 장면이면 추론 생략 (비활성 상태에서는 하트비트 주기로만 실행)
+        bool runInference = !presenceGate || presenceGate->shouldInfer(depthFrame);
+        metrics.presenceActive.set(!presenceGate || presenceGate->isActive() ? 1.0 : 0.0);
         
-        // 중앙 지점의 거리 정보 계산 - DepthProcessor 클래스 함수 사용
-        float centerDist = DepthProcessor::calculateCenterDistance(depthFrame, config.depth_range.max);
+        // 품질 조절 단계의 추론 간격: 사이 프레임은 직전 결과를 그대로 사용
+        bool reuseResult = runInference && governor && !governor->shouldInfer(frameNumber + 1);
         
         // 포즈 추정 실행
-        std::vector<std::vector<cv::Point>> keypoints;
-        bool success = poseEstimator.detect(colorImage, keypoints);
+        bool success = false;
+        if (runInference && !reuseResult) {
+            success = poseEstimator->detect(colorImage, poseResult);
+        } else if (!runInference) {
+            metrics.inferenceSkipped.increment();
+        }
+        timing.markPoseDone();
+        frameNumber++;
+        metrics.frames.increment();
+        
+        if (success) {
+            const PoseEstimator::StageTimings& timings = poseEstimator->getLastTimings();
+            metrics.preprocess.observe(timings.preprocessMs / 1000.0);
+            metrics.infer.observe(timings.inferenceMs / 1000.0);
+            inferenceTimes.add(static_cast<float>(timings.inferenceMs / 1000.0));
+            metrics.postprocess.observe(timings.postprocessMs / 1000.0);
+        }
+        
+        if (!success && !reuseResult) {
+            poseResult.reset(frameNumber, 0, colorImage.cols, colorImage.rows, 0.0f);
+        }
+        poseResult.frameNumber = frameNumber;
+        if (presenceGate && success) {
+            presenceGate->reportDetection(poseResult.countVisible());
+        }
         
-        // 포즈 추정 결과 시각화
-        cv::Mat& poseImage = colorImage;
+        // 3D 키포인트 계산 (발행 또는 공유 메모리 링에서 필요할 때만)
+        bool need3d = (publisher && config.publish.include_3d) || frameRing;
+        if (need3d) {
+            DepthProcessor::deprojectKeypoints(depthFrame, poseResult);
+        }
         
-        // Visualizer를 사용하여 결과 그리기 및 표시
-        Utils::Visualizer::drawResults(poseImage, enhancedDepth, keypoints, fps, centerDist, config);
+        // 키포인트 발행 (논블로킹)
+        if (publisher && success) {
+            if (!publisher->publish(frameNumber, poseResult, config.publish.include_3d)) {
+                metrics.publishDropped.increment();
+            }
+        }
+        
+        // 공유 메모리 링에 원본 프레임과 키포인트 발행 (오버레이가 그려지기 전)
+        if (frameRing) {
+            int numKeypoints = poseEstimator->getNumKeypoints();
+            if (!frameRing->isCreated() &&
+                !frameRing->create(colorFrame.get_width(), colorFrame.get_height(), colorFrame.get_bytes_per_pixel(),
+                                   sensorDepthFrame.get_width(), sensorDepthFrame.get_height(), sensorDepthFrame.get_units(),
+                                   config.shared_memory.max_persons, numKeypoints)) {
+                std::cerr << "공유 메모리 링을 비활성화합니다." << std::endl;
+                frameRing.reset();
+            } else {
+                Utils::KeypointPublisher::packKeypoints(poseResult, numKeypoints, ringKeypoints2d);
+                Utils::KeypointPublisher::packKeypoints3D(poseResult, numKeypoints, ringKeypoints3d);
+                
+                Utils::SharedFrameRing::Frame ringFrame;
+                ringFrame.frameNumber = frameNumber;
+                ringFrame.sensorTimestampMs = frames.get_timestamp();
+                ringFrame.color = static_cast<const uint8_t*>(colorFrame.get_data());
+                ringFrame.colorWidth = colorFrame.get_width();
+                ringFrame.colorHeight = colorFrame.get_height();
+                ringFrame.colorStride = colorFrame.get_stride_in_bytes();
+                ringFrame.depth = static_cast<const uint16_t*>(sensorDepthFrame.get_data());
+                ringFrame.depthWidth = sensorDepthFrame.get_width();
+                ringFrame.depthHeight = sensorDepthFrame.get_height();
+                ringFrame.depthStride = sensorDepthFrame.get_stride_in_bytes();
+                ringFrame.keypoints2d = ringKeypoints2d.data();
+                ringFrame.keypoints3d = ringKeypoints3d.data();
+                ringFrame.numPersons = poseResult.numPersons;
+                ringFrame.numKeypoints = numKeypoints;
+                if (!frameRing->publish(ringFrame)) {
+                    std::cerr << "공유 메모리 링을 비활성화합니다." << std::endl;
+                    frameRing.reset();
+                }
+            }
+        }
+        
+        // 동영상 녹화 (녹화 간격마다 인코더 큐에 복사만 하고, 큐가 가득 차면 드롭)
+        if (recorder && recorder->wantsFrame() &&
+            !recorder->submit(colorImage, depthFrame, poseResult, frameStats, centerDist, &lastLatency)) {
+            metrics.recordDropped.increment();
+        }
+        
+        // 포즈 추정 결과 시각화 - 표시 스레드에 프레임만 넘기고 바로 다음 프레임 처리
+        // - 오버레이에는 직전 프레임의 지연 표시 (현재 프레임은 렌더 완료 전)
+        if (showThisFrame) {
+            Utils::Metrics::ScopedTimer timer(metrics.render);
+            displayViews[0].color = colorImage;
+            displayViews[0].depth = depthVisualized ? enhancedDepth : lastEnhancedDepth;
+            displayViews[0].pose = &poseResult;
+            displayViews[0].centerDist = centerDist;
+            display->submit(displayViews, frameStats, &lastLatency, live->depth_range.min, live->depth_range.max);
+        }
+        
+        // 센서→결과(헤드리스는 결과 발행) 지연 측정 및 최신 프레임 모드의 버려진 프레임 집계
+        timing.markRenderDone();
+        recordLatency(timing, metrics, latencyLogger.get());
+        lastLatency = timing.breakdown();
+        if (lastLatency.endToEndMs >= 0.0) {
+            endToEndLatency.add(static_cast<float>(lastLatency.endToEndMs / 1000.0));
+        }
+        
+        // 품질 조절: 프레임 처리 시간(수신 → 렌더 완료)으로 단계 판단
+        if (governor) {
+            if (governor->update(timing.renderDoneMs - timing.acquiredMs)) {
+                applyGovernorLevel(*governor, *poseEstimator, decimationFilter);
+            }
+            metrics.qualityLevel.set(governor->getLevelIndex());
+        }
+        uint64_t staleDrops = camera.getDroppedCount();
+        if (staleDrops > reportedStaleDrops) {
+            metrics.staleDropped.increment(staleDrops - reportedStaleDrops);
+            reportedStaleDrops = staleDrops;
+        }
+        recordFramePool(metrics, reportedPool);
+        
+        if (headless) {
+            // 헤드리스 모드: 주기적으로 상태 로그 출력
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastStatusTime >= std::chrono::seconds(config.runtime.status_interval_sec)) {
+                lastStatusTime = now;
+                std::cout << "[상태] frame " << frameNumber << ", FPS " << std::fixed << std::setprecision(1) << frameStats.fps
+                          << ", 프레임 p50/p99/max " << frameStats.p50Ms << "/" << frameStats.p99Ms << "/" << frameStats.maxMs << "ms"
+                          << ", 추론 p50/p99 " << inferenceTimes.percentile(0.5f) * 1000.0f
+                          << "/" << inferenceTimes.percentile(0.99f) * 1000.0f << "ms"
+                          << ", 센서→결과 p50/p99 " << endToEndLatency.percentile(0.5f) * 1000.0f
+                          << "/" << endToEndLatency.percentile(0.99f) * 1000.0f << "ms"
+                          << ", 버려진 프레임 " << staleDrops
+                          << ", 중앙 거리 " << std::setprecision(2) << centerDist << "m";
+                if (presenceGate) {
+                    std::cout << (presenceGate->isActive() ? ", 재실" : ", 유휴 (추론 생략)");
+                }
+                if (governor) {
+                    std::cout << ", 품질 단계 " << governor->getLevelIndex() << "/" << governor->getLevelCount() - 1
+                              << " (평균 " << governor->getAverageFrameMs() << "ms)";
+                }
+                if (publisher) {
+                    std::cout << ", 발행 " << publisher->getSentCount() << " / 드롭 " << publisher->getDroppedCount();
+                }
+                if (recorder) {
+                    std::cout << ", 녹화 " << recorder->getWrittenCount() << " / 드롭 " << recorder->getDroppedCount();
+                }
+                std::cout << std::endl;
+            }
+        }
         
         // 키 입력 대기 (1ms)
         keyboard.waitKey(1);
         
         // 's' 키를 누르면 이미지와 깊이 맵 저장
         if (keyboard.isSavePressed()) {
-            // 포즈 추정 결과도 함께 저장
-            imageSaver.saveImages(poseImage, enhancedDepth, depthFrame);
+            Utils::Metrics::ScopedTimer timer(metrics.save);
+            if (!depthVisualized) {
+                enhancedDepth = DepthProcessor::enhancedDepthVisualization(depthFrame, *live);
+            }
+            // 컬러는 오버레이 없는 원본 (오프라인 배치 추출/회귀 검사가 다시 추론하는 입력)
+            cv::Mat saveImage = Utils::ColorConversion::toBgr(colorImage);
+            if (imageSaver->saveImages(saveImage, enhancedDepth, depthFrame) && live->pointcloud.save_ply) {
+                savePersonClouds(cloudExtractor, depthFrame, poseResult, imageSaver->getLastCapturePrefix(), cloud);
+            }
         }
     }
     
-    Utils::Visualizer::destroyWindows();
+    if (recorder) {
+        recorder->stop();
+    }
+    if (display) {
+        display->stop();
+    }
     
     return EXIT_SUCCESS; 
 }
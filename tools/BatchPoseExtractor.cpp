@@ -0,0 +1,348 @@
+// 저장된 캡처(color.png, depth.bin)에서 오프라인으로 포즈를 추출하는 배치 도구
+// 사용법: ./build/BatchPoseExtractor <입력 디렉토리> <출력 파일> [--config config.yaml] [--threads N] [--group N] [--no-3d] [--restart]
+//  - 입력 디렉토리 아래의 저장 세션 색인(index.csv)과 이전 resultN/ 폴더를 모두 처리
+//  - 출력은 열 단위 행 그룹 파일 하나 (utils/PoseColumnWriter.h), 완료된 그룹은 <출력 파일>.index에 기록
+//  - 중단 후 같은 명령으로 다시 실행하면 마지막으로 완료된 그룹 다음부터 이어서 처리 (--restart면 처음부터)
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <algorithm>
+#include <csignal>
+#include <cstdlib>
+#include <unistd.h>
+#include <opencv2/opencv.hpp>
+#include <librealsense2/rsutil.h>
+#include "ConfigManager.h"
+#include "PoseEstimator.h"
+#include "PoseResult.h"
+#include "utils/ThreadPool.h"
+#include "utils/PoseColumnWriter.h"
+#include "utils/CaptureIndex.h"
+
+namespace {
+    volatile std::sig_atomic_t running = 1;
+
+    void handleSignal(int) {
+        running = 0;
+    }
+
+    struct Options {
+        std::string inputDir;
+        std::string outputPath;
+        std::string configPath = "config.yaml";
+        int threads = 0;     // 디코드 스레드 수 (0이면 하드웨어 스레드 수)
+        int groupSize = 64;  // 행 그룹(= 한 번에 디코드/추론하는 프레임) 크기
+        bool with3d = true;
+        bool restart = false;
+    };
+
+    // 캡처 하나의 디코드 결과
+    struct WorkItem {
+        size_t index;            // 정렬된 전체 목록에서의 위치 (출력 frameNumber)
+        std::string source;      // 캡처 파일 접두사
+        cv::Mat image;
+        cv::Mat depth;           // CV_32FC1 미터 단위, depth.bin이 없으면 비어 있음
+        bool hasIntrinsics;
+        rs2_intrinsics intrinsics;
+        bool ok;
+    };
+
+    bool parseOptions(int argc, char* argv[], Options& options) {
+        if (argc < 3) {
+            return false;
+        }
+        options.inputDir = argv[1];
+        options.outputPath = argv[2];
+        for (int i = 3; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--config" && i + 1 < argc) {
+                options.configPath = argv[++i];
+            } else if (arg == "--threads" && i + 1 < argc) {
+                options.threads = std::atoi(argv[++i]);
+            } else if (arg == "--group" && i + 1 < argc) {
+                options.groupSize = std::max(1, std::atoi(argv[++i]));
+            } else if (arg == "--no-3d") {
+                options.with3d = false;
+            } else if (arg == "--restart") {
+                options.restart = true;
+            } else {
+                std::cerr << "알 수 없는 옵션: " << arg << std::endl;
+                return false;
+            }
+        }
+        if (options.threads <= 0) {
+            options.threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return true;
+    }
+
+    // 작업 색인 읽기 - 캡처 접두사 줄들 뒤에 "@<출력 파일 크기>" 줄이 있어야 그 그룹이 완료된 것으로 인정
+    // - 마지막 "@" 뒤에 남은 경로(기록 도중 중단된 그룹)는 버림
+    int64_t loadIndex(const std::string& indexPath, std::set<std::string>& done) {
+        std::ifstream index(indexPath);
+        if (!index) {
+            return 0;
+        }
+
+        int64_t committedBytes = 0;
+        std::vector<std::string> group;
+        std::string line;
+        while (std::getline(index, line)) {
+            if (line.empty()) continue;
+            if (line[0] == '@') {
+                committedBytes = std::atoll(line.c_str() + 1);
+                done.insert(group.begin(), group.end());
+                group.clear();
+            } else {
+                group.push_back(line);
+            }
+        }
+        return committedBytes;
+    }
+
+    // DepthProcessor::saveDepthIntrinsics가 저장한 깊이 내부 파라미터
+    bool readIntrinsics(const std::string& path, rs2_intrinsics& intrinsics) {
+        cv::FileStorage fs(path, cv::FileStorage::READ);
+        if (!fs.isOpened()) {
+            return false;
+        }
+        int model = 0;
+        fs["width"] >> intrinsics.width;
+        fs["height"] >> intrinsics.height;
+        fs["fx"] >> intrinsics.fx;
+        fs["fy"] >> intrinsics.fy;
+        fs["ppx"] >> intrinsics.ppx;
+        fs["ppy"] >> intrinsics.ppy;
+        fs["model"] >> model;
+        intrinsics.model = static_cast<rs2_distortion>(model);
+        std::vector<float> coeffs;
+        fs["coeffs"] >> coeffs;
+        for (int i = 0; i < 5; i++) {
+            intrinsics.coeffs[i] = i < static_cast<int>(coeffs.size()) ? coeffs[i] : 0.0f;
+        }
+        return intrinsics.fx > 0.0f && intrinsics.fy > 0.0f;
+    }
+
+    void loadItem(WorkItem& item, bool with3d) {
+        item.image = cv::imread(item.source + "color.png", cv::IMREAD_COLOR);
+        item.ok = !item.image.empty();
+        item.depth.release();
+        item.hasIntrinsics = false;
+        if (item.ok && with3d && Utils::CaptureIndex::readDepthBin(item.source + "depth.bin", item.depth)) {
+            item.hasIntrinsics = readIntrinsics(item.source + "depth_intrinsics.yml", item.intrinsics);
+        }
+    }
+
+    // DepthProcessor::deprojectKeypoints와 같은 방식 (저장된 깊이 맵 기준)
+    void deprojectKeypoints(const cv::Mat& depth, const rs2_intrinsics& intrinsics, PoseResult& result) {
+        float scaleX = result.imageWidth > 0 ? static_cast<float>(depth.cols) / result.imageWidth : 1.0f;
+        float scaleY = result.imageHeight > 0 ? static_cast<float>(depth.rows) / result.imageHeight : 1.0f;
+
+        for (int p = 0; p < result.numPersons; p++) {
+            for (int k = 0; k < result.numKeypoints; k++) {
+                result.cameraX[p][k] = 0.0f;
+                result.cameraY[p][k] = 0.0f;
+                result.cameraZ[p][k] = 0.0f;
+                if (!result.isVisible(p, k)) continue;
+
+                float pixel[2] = {result.x[p][k] * scaleX, result.y[p][k] * scaleY};
+                int px = static_cast<int>(pixel[0]);
+                int py = static_cast<int>(pixel[1]);
+                if (px < 0 || px >= depth.cols || py < 0 || py >= depth.rows) continue;
+
+                float dist = depth.at<float>(py, px);
+                if (dist <= 0.001f) continue;
+
+                float point3d[3];
+                rs2_deproject_pixel_to_point(point3d, &intrinsics, pixel, dist);
+                result.cameraX[p][k] = point3d[0];
+                result.cameraY[p][k] = point3d[1];
+                result.cameraZ[p][k] = point3d[2];
+            }
+        }
+        result.flags |= PoseResult::kHas3D;
+    }
+
+    double elapsedMs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::cerr << "사용법: " << argv[0] << " <입력 디렉토리> <출력 파일> [--config config.yaml] "
+                  << "[--threads N] [--group N] [--no-3d] [--restart]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    AppConfig config;
+    if (!ConfigManager::loadConfig(options.configPath, config) || !ConfigManager::validateConfig(config)) {
+        std::cerr << "기본 설정을 사용합니다." << std::endl;
+        ConfigManager::setDefaultConfig(config);
+    }
+
+    PoseEstimator poseEstimator(config);
+    int numKeypoints = poseEstimator.getNumKeypoints();
+    if (numKeypoints <= 0) {
+        return EXIT_FAILURE;
+    }
+
+    // 작업 목록과 이미 완료된 그룹 확인
+    std::vector<std::string> captures = Utils::CaptureIndex::findCaptures(options.inputDir);
+    std::string indexPath = options.outputPath + ".index";
+    std::set<std::string> done;
+    int64_t committedBytes = options.restart ? 0 : loadIndex(indexPath, done);
+    bool resume = committedBytes > 0;
+    if (resume) {
+        // 완료 표시 이후에 기록된 (중단된 그룹의) 데이터 잘라내기
+        if (truncate(options.outputPath.c_str(), static_cast<off_t>(committedBytes)) != 0) {
+            std::cerr << "출력 파일을 이어서 쓸 수 없습니다: " << options.outputPath << std::endl;
+            return EXIT_FAILURE;
+        }
+    } else {
+        done.clear();
+    }
+
+    std::vector<WorkItem> pending;
+    for (size_t i = 0; i < captures.size(); i++) {
+        if (done.count(captures[i])) continue;
+        WorkItem item;
+        item.index = i;
+        item.source = captures[i];
+        item.hasIntrinsics = false;
+        item.ok = false;
+        pending.push_back(item);
+    }
+
+    std::cout << "캡처 " << captures.size() << "개 중 " << pending.size() << "개 처리 예정"
+              << (resume ? " (이어서 처리)" : "") << ", 디코드 스레드 " << options.threads
+              << ", 그룹 크기 " << options.groupSize << std::endl;
+    if (pending.empty()) {
+        return EXIT_SUCCESS;
+    }
+
+    Utils::PoseColumnWriter writer(numKeypoints);
+    if (!writer.open(options.outputPath, resume)) {
+        return EXIT_FAILURE;
+    }
+    std::ofstream index(indexPath, resume ? std::ios::app : std::ios::trunc);
+    if (!index) {
+        std::cerr << "파일을 열 수 없습니다: " << indexPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    Utils::ThreadPool decodePool(options.threads);
+    auto decodeGroup = [&](size_t start) {
+        size_t count = std::min(pending.size() - start, static_cast<size_t>(options.groupSize));
+        decodePool.parallelFor(static_cast<int>(count), [&](int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                loadItem(pending[start + i], options.with3d);
+            }
+        });
+    };
+
+    std::vector<cv::Mat> images;
+    std::vector<WorkItem*> batchItems;
+    std::vector<PoseResult> results;
+    size_t processed = 0;
+    size_t failed = 0;
+    size_t with3dCount = 0;
+    double decodeWaitMs = 0.0;
+    double inferenceMs = 0.0;
+    bool aborted = false;
+    auto runStart = std::chrono::steady_clock::now();
+
+    // 다음 그룹 디코드를 현재 그룹 추론과 겹쳐서 실행
+    std::future<void> nextDecode = std::async(std::launch::async, decodeGroup, 0);
+    for (size_t start = 0; start < pending.size() && running; start += options.groupSize) {
+        size_t count = std::min(pending.size() - start, static_cast<size_t>(options.groupSize));
+
+        auto waitStart = std::chrono::steady_clock::now();
+        nextDecode.get();
+        decodeWaitMs += elapsedMs(waitStart);
+
+        images.clear();
+        batchItems.clear();
+        for (size_t i = start; i < start + count; i++) {
+            if (pending[i].ok) {
+                images.push_back(pending[i].image);
+                batchItems.push_back(&pending[i]);
+            } else {
+                std::cerr << "이미지를 읽을 수 없습니다: " << pending[i].source << "color.png" << std::endl;
+                failed++;
+            }
+        }
+
+        size_t nextStart = start + count;
+        if (nextStart < pending.size() && running) {
+            nextDecode = std::async(std::launch::async, decodeGroup, nextStart);
+        }
+
+        auto inferStart = std::chrono::steady_clock::now();
+        if (!images.empty() && !poseEstimator.detectBatch(images, results)) {
+            std::cerr << "포즈 추정 실패 - 중단합니다." << std::endl;
+            aborted = true;
+            break;
+        }
+        inferenceMs += elapsedMs(inferStart);
+
+        for (size_t i = 0; i < batchItems.size(); i++) {
+            WorkItem& item = *batchItems[i];
+            PoseResult& result = results[i];
+            result.frameNumber = item.index;
+            if (!item.depth.empty() && item.hasIntrinsics) {
+                deprojectKeypoints(item.depth, item.intrinsics, result);
+                with3dCount++;
+            }
+            writer.add(item.source, result);
+            item.image.release();
+            item.depth.release();
+        }
+
+        // 출력 파일을 먼저 flush한 뒤 색인에 완료 표시 (읽지 못한 캡처는 다음 실행에서 다시 시도)
+        int64_t bytes = writer.flushGroup();
+        if (bytes < 0) {
+            std::cerr << "출력 파일 기록 실패: " << options.outputPath << std::endl;
+            aborted = true;
+            break;
+        }
+        for (WorkItem* item : batchItems) {
+            index << item->source << "\n";
+        }
+        index << "@" << bytes << std::endl;
+        processed += batchItems.size();
+
+        // 진행 상황과 처리량
+        double elapsedSec = elapsedMs(runStart) / 1000.0;
+        double fps = elapsedSec > 0.0 ? processed / elapsedSec : 0.0;
+        size_t remaining = pending.size() - nextStart;
+        std::cout << "[배치] " << processed + failed << "/" << pending.size()
+                  << std::fixed << std::setprecision(1)
+                  << " (" << 100.0 * (processed + failed) / pending.size() << "%) | "
+                  << fps << " fps | 추론 " << (processed > 0 ? inferenceMs / processed : 0.0) << "ms/프레임"
+                  << " | 디코드 대기 " << decodeWaitMs / 1000.0 << "s"
+                  << " | 남은 시간 " << (fps > 0.0 ? remaining / fps : 0.0) << "s" << std::endl;
+    }
+
+    if (nextDecode.valid()) {
+        nextDecode.wait();
+    }
+    writer.close();
+
+    double totalSec = elapsedMs(runStart) / 1000.0;
+    std::cout << (running && !aborted ? "완료" : "중단됨 (같은 명령으로 이어서 처리 가능)") << ": "
+              << processed << "개 프레임 (3D " << with3dCount << "개), 실패 " << failed << "개, "
+              << std::fixed << std::setprecision(1) << totalSec << "s, "
+              << (totalSec > 0.0 ? processed / totalSec : 0.0) << " fps -> " << options.outputPath << std::endl;
+    return (aborted || failed > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,329 @@
+// 골든 시퀀스 회귀 검사 도구 - 저장된 캡처를 DepthProcessor/PoseEstimator로 처리해 저장해 둔 골든 출력과 비교
+// 사용법:
+//   ./build/GoldenRegression record <캡처 디렉토리> <골든 디렉토리> [--config config.yaml] [--runs N] [--margin 1.5] [--no-pose]
+//   ./build/GoldenRegression check <캡처 디렉토리> <골든 디렉토리> [--config config.yaml] [--runs N] [--tolerance 2.0]
+//                                  [--no-pose] [--no-timing]
+//  - 깊이 컬러맵: 골든 PNG와 비트 단위 일치
+//  - 키포인트: 골든에서 보이는 관절은 --tolerance 픽셀 이내, 보임 여부는 신뢰도가 임계값 근처가 아니면 일치
+//  - 단계별 시간(depth, preprocess, inference, postprocess)의 중앙값/p99가 골든 예산(record 측정값 x margin)을 넘으면 실패
+//  - GPU 없는 환경: -DWITH_TENSORRT=OFF로 빌드하고 pose.backend: "opencv"와 ONNX 모델 사용
+//  - 종료 코드: 통과 0, 실패 1
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <memory>
+#include <opencv2/opencv.hpp>
+#include "ConfigManager.h"
+#include "DepthProcessor.h"
+#include "PoseEstimator.h"
+#include "PoseResult.h"
+#include "utils/CaptureIndex.h"
+#include "utils/FileUtils.h"
+
+namespace {
+    // depth.bin(미터 float)을 Z16으로 되돌릴 때의 깊이 단위 (D400 기본값)
+    const float DEPTH_UNITS = 0.001f;
+
+    // 보임 여부 비교에서 제외하는 임계값 주변 신뢰도 범위
+    const float SCORE_MARGIN = 0.05f;
+
+    const char* const STAGE_NAMES[] = {"depth", "preprocess", "inference", "postprocess"};
+    const int NUM_STAGES = 4;
+
+    struct Options {
+        bool record = false;
+        std::string sequenceDir;
+        std::string goldenDir;
+        std::string configPath = "config.yaml";
+        int runs = 3;           // 시퀀스 반복 횟수 (2회 이상이면 첫 회는 워밍업으로 시간 측정에서 제외)
+        double margin = 1.5;    // record: 측정 시간 x margin을 예산으로 저장
+        double tolerance = 2.0; // check: 키포인트 허용 오차 (픽셀)
+        bool withPose = true;
+        bool withTiming = true;
+    };
+
+    // 캡처 하나의 입력
+    struct Frame {
+        std::string source;
+        cv::Mat color;
+        cv::Mat depthRaw; // CV_16UC1, DEPTH_UNITS 단위
+    };
+
+    bool parseOptions(int argc, char* argv[], Options& options) {
+        if (argc < 4) {
+            return false;
+        }
+        std::string mode = argv[1];
+        if (mode != "record" && mode != "check") {
+            return false;
+        }
+        options.record = mode == "record";
+        options.sequenceDir = argv[2];
+        options.goldenDir = argv[3];
+        for (int i = 4; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--config" && i + 1 < argc) {
+                options.configPath = argv[++i];
+            } else if (arg == "--runs" && i + 1 < argc) {
+                options.runs = std::max(1, std::atoi(argv[++i]));
+            } else if (arg == "--margin" && i + 1 < argc) {
+                options.margin = std::atof(argv[++i]);
+            } else if (arg == "--tolerance" && i + 1 < argc) {
+                options.tolerance = std::atof(argv[++i]);
+            } else if (arg == "--no-pose") {
+                options.withPose = false;
+            } else if (arg == "--no-timing") {
+                options.withTiming = false;
+            } else {
+                std::cerr << "알 수 없는 옵션: " << arg << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool loadFrames(const std::string& sequenceDir, std::vector<Frame>& frames) {
+        std::vector<std::string> captures = Utils::CaptureIndex::findCaptures(sequenceDir);
+        cv::Mat depthMeters;
+        for (const std::string& source : captures) {
+            Frame frame;
+            frame.source = source;
+            frame.color = cv::imread(source + "color.png", cv::IMREAD_COLOR);
+            if (frame.color.empty() || !Utils::CaptureIndex::readDepthBin(source + "depth.bin", depthMeters)) {
+                std::cerr << "캡처를 읽을 수 없습니다: " << source << std::endl;
+                return false;
+            }
+            depthMeters.convertTo(frame.depthRaw, CV_16UC1, 1.0 / DEPTH_UNITS);
+            frames.push_back(frame);
+        }
+        return !frames.empty();
+    }
+
+    std::string frameKey(const char* prefix, size_t index) {
+        char key[32];
+        std::snprintf(key, sizeof(key), "%s%06zu", prefix, index);
+        return key;
+    }
+
+    // 사람 순서, 관절 순서로 (x, y, score) 평탄화
+    void packKeypoints(const PoseResult& result, std::vector<float>& packed) {
+        packed.clear();
+        for (int p = 0; p < result.numPersons; p++) {
+            for (int k = 0; k < result.numKeypoints; k++) {
+                packed.push_back(result.x[p][k]);
+                packed.push_back(result.y[p][k]);
+                packed.push_back(result.score[p][k]);
+            }
+        }
+    }
+
+    double percentile(std::vector<double> samples, double q) {
+        if (samples.empty()) return 0.0;
+        std::sort(samples.begin(), samples.end());
+        size_t index = static_cast<size_t>(std::ceil(q * samples.size()));
+        return samples[std::min(samples.size() - 1, index > 0 ? index - 1 : 0)];
+    }
+
+    // 키포인트 비교 - 실패 관절 수 반환, 최대 오차 갱신
+    int compareKeypoints(const std::vector<float>& golden, const std::vector<float>& current, int numKeypoints,
+                         float threshold, double tolerance, double& maxError) {
+        if (golden.size() != current.size()) {
+            std::cerr << "  사람 수 불일치: 골든 " << golden.size() / (3 * numKeypoints)
+                      << "명, 현재 " << current.size() / (3 * numKeypoints) << "명" << std::endl;
+            return 1;
+        }
+        int failures = 0;
+        for (size_t i = 0; i < golden.size(); i += 3) {
+            float goldenScore = golden[i + 2];
+            float currentScore = current[i + 2];
+            bool goldenVisible = goldenScore >= threshold;
+            bool currentVisible = currentScore >= threshold;
+            if (goldenVisible != currentVisible) {
+                // 임계값 근처 신뢰도의 보임 여부 변화는 허용
+                if (std::abs(goldenScore - threshold) > SCORE_MARGIN) failures++;
+                continue;
+            }
+            if (!goldenVisible) continue;
+            double error = std::hypot(golden[i] - current[i], golden[i + 1] - current[i + 1]);
+            maxError = std::max(maxError, error);
+            if (error > tolerance) failures++;
+        }
+        return failures;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::cerr << "사용법: " << argv[0] << " record|check <캡처 디렉토리> <골든 디렉토리> [--config config.yaml] "
+                  << "[--runs N] [--margin 1.5] [--tolerance 2.0] [--no-pose] [--no-timing]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    AppConfig config;
+    if (!ConfigManager::loadConfig(options.configPath, config) || !ConfigManager::validateConfig(config)) {
+        std::cerr << "기본 설정을 사용합니다." << std::endl;
+        ConfigManager::setDefaultConfig(config);
+    }
+
+    std::vector<Frame> frames;
+    if (!loadFrames(options.sequenceDir, frames)) {
+        std::cerr << "캡처 시퀀스를 읽을 수 없습니다: " << options.sequenceDir << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::unique_ptr<PoseEstimator> poseEstimator;
+    if (options.withPose) {
+        poseEstimator.reset(new PoseEstimator(config));
+        if (!poseEstimator->isInitialized()) {
+            return EXIT_FAILURE;
+        }
+    }
+    int numKeypoints = poseEstimator ? poseEstimator->getNumKeypoints() : 0;
+
+    // 시퀀스 실행 - 출력은 첫 회 결과, 시간은 워밍업을 제외한 모든 회
+    std::vector<cv::Mat> colormaps(frames.size());
+    std::vector<std::vector<float>> keypoints(frames.size());
+    std::vector<double> stageSamples[NUM_STAGES];
+    PoseResult result;
+    for (int run = 0; run < options.runs; run++) {
+        bool measure = options.runs == 1 || run > 0;
+        for (size_t i = 0; i < frames.size(); i++) {
+            auto depthStart = std::chrono::steady_clock::now();
+            cv::Mat colormap = DepthProcessor::enhancedDepthVisualization(frames[i].depthRaw, DEPTH_UNITS, config);
+            double depthMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - depthStart).count();
+            if (run == 0) colormaps[i] = colormap;
+            if (measure) stageSamples[0].push_back(depthMs);
+
+            if (!poseEstimator) continue;
+            if (!poseEstimator->detect(frames[i].color, result)) {
+                std::cerr << "포즈 추정 실패: " << frames[i].source << std::endl;
+                return EXIT_FAILURE;
+            }
+            if (run == 0) packKeypoints(result, keypoints[i]);
+            if (measure) {
+                const PoseEstimator::StageTimings& timings = poseEstimator->getLastTimings();
+                stageSamples[1].push_back(timings.preprocessMs);
+                stageSamples[2].push_back(timings.inferenceMs);
+                stageSamples[3].push_back(timings.postprocessMs);
+            }
+        }
+    }
+
+    double medians[NUM_STAGES];
+    double tails[NUM_STAGES];
+    for (int s = 0; s < NUM_STAGES; s++) {
+        medians[s] = percentile(stageSamples[s], 0.5);
+        tails[s] = percentile(stageSamples[s], 0.99);
+    }
+
+    if (options.record) {
+        // 골든 출력 기록
+        if (!Utils::FileUtils::createDirectory(options.goldenDir)) {
+            std::cerr << "골든 디렉토리 생성 실패: " << options.goldenDir << std::endl;
+            return EXIT_FAILURE;
+        }
+        for (size_t i = 0; i < frames.size(); i++) {
+            cv::imwrite(options.goldenDir + "/" + frameKey("depth_", i) + ".png", colormaps[i]);
+        }
+        cv::FileStorage keypointFile(options.goldenDir + "/keypoints.yml", cv::FileStorage::WRITE);
+        keypointFile << "frames" << static_cast<int>(frames.size());
+        keypointFile << "num_keypoints" << numKeypoints;
+        for (size_t i = 0; i < frames.size() && poseEstimator; i++) {
+            keypointFile << frameKey("f", i) << keypoints[i];
+        }
+        keypointFile.release();
+
+        cv::FileStorage budgetFile(options.goldenDir + "/budget.yml", cv::FileStorage::WRITE);
+        for (int s = 0; s < NUM_STAGES; s++) {
+            if (stageSamples[s].empty()) continue;
+            budgetFile << std::string(STAGE_NAMES[s]) + "_median_ms" << medians[s] * options.margin;
+            budgetFile << std::string(STAGE_NAMES[s]) + "_p99_ms" << tails[s] * options.margin;
+        }
+        budgetFile.release();
+
+        std::cout << "골든 출력 기록: " << frames.size() << "개 프레임 -> " << options.goldenDir
+                  << " (시간 예산 x" << options.margin << ")" << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    // 골든 출력과 비교
+    int failures = 0;
+    cv::FileStorage keypointFile(options.goldenDir + "/keypoints.yml", cv::FileStorage::READ);
+    int goldenFrames = keypointFile.isOpened() ? static_cast<int>(keypointFile["frames"]) : -1;
+    if (goldenFrames != static_cast<int>(frames.size())) {
+        std::cerr << "[실패] 프레임 수 불일치: 골든 " << goldenFrames << ", 시퀀스 " << frames.size() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int depthMismatches = 0;
+    for (size_t i = 0; i < frames.size(); i++) {
+        cv::Mat golden = cv::imread(options.goldenDir + "/" + frameKey("depth_", i) + ".png", cv::IMREAD_UNCHANGED);
+        if (golden.empty() || golden.size() != colormaps[i].size() || golden.type() != colormaps[i].type() ||
+            cv::norm(golden, colormaps[i], cv::NORM_INF) != 0.0) {
+            std::cerr << "[실패] 깊이 컬러맵 불일치: " << frames[i].source << std::endl;
+            depthMismatches++;
+        }
+    }
+    failures += depthMismatches;
+    std::cout << "깊이 컬러맵: " << frames.size() - depthMismatches << "/" << frames.size() << " 일치" << std::endl;
+
+    if (poseEstimator) {
+        int goldenKeypoints = static_cast<int>(keypointFile["num_keypoints"]);
+        if (goldenKeypoints != numKeypoints) {
+            std::cerr << "[실패] 키포인트 수 불일치: 골든 " << goldenKeypoints << ", 모델 " << numKeypoints << std::endl;
+            return EXIT_FAILURE;
+        }
+        int keypointFailures = 0;
+        double maxError = 0.0;
+        std::vector<float> golden;
+        for (size_t i = 0; i < frames.size(); i++) {
+            golden.clear();
+            keypointFile[frameKey("f", i)] >> golden;
+            int frameFailures = compareKeypoints(golden, keypoints[i], numKeypoints, config.pose.confidence_threshold,
+                                                 options.tolerance, maxError);
+            if (frameFailures > 0) {
+                std::cerr << "[실패] 키포인트 " << frameFailures << "개 허용 오차 초과: " << frames[i].source << std::endl;
+                keypointFailures += frameFailures;
+            }
+        }
+        failures += keypointFailures;
+        std::cout << "키포인트: 실패 " << keypointFailures << "개, 최대 오차 " << std::fixed << std::setprecision(2)
+                  << maxError << "px (허용 " << options.tolerance << "px)" << std::endl;
+    }
+
+    if (options.withTiming) {
+        // 측정한 단계의 예산이 없으면 실패 (기록하지 않은 예산으로 시간 검사가 조용히 통과하지 않도록 - 필요 없으면 --no-timing)
+        cv::FileStorage budgetFile(options.goldenDir + "/budget.yml", cv::FileStorage::READ);
+        if (!budgetFile.isOpened()) {
+            std::cerr << "[실패] 시간 예산 파일 없음: " << options.goldenDir << "/budget.yml (--no-timing으로 생략 가능)" << std::endl;
+            failures++;
+        }
+        for (int s = 0; s < NUM_STAGES && budgetFile.isOpened(); s++) {
+            if (stageSamples[s].empty()) continue;
+            cv::FileNode medianNode = budgetFile[std::string(STAGE_NAMES[s]) + "_median_ms"];
+            cv::FileNode tailNode = budgetFile[std::string(STAGE_NAMES[s]) + "_p99_ms"];
+            if (medianNode.empty() || tailNode.empty()) {
+                std::cerr << "[실패] " << STAGE_NAMES[s] << ": 시간 예산 항목 없음 (" << STAGE_NAMES[s]
+                          << "_median_ms, " << STAGE_NAMES[s] << "_p99_ms)" << std::endl;
+                failures++;
+                continue;
+            }
+            double medianBudget = static_cast<double>(medianNode);
+            double tailBudget = static_cast<double>(tailNode);
+            bool ok = medians[s] <= medianBudget && tails[s] <= tailBudget;
+            std::cout << (ok ? "[통과] " : "[실패] ") << STAGE_NAMES[s] << ": 중앙값 " << std::fixed << std::setprecision(2)
+                      << medians[s] << "/" << medianBudget << "ms, p99 " << tails[s] << "/" << tailBudget << "ms" << std::endl;
+            if (!ok) failures++;
+        }
+    }
+
+    std::cout << (failures == 0 ? "회귀 검사 통과" : "회귀 검사 실패") << " (" << frames.size() << "개 프레임)" << std::endl;
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,119 @@
+// 키포인트 발행 소켓의 참조 구독자
+// 사용법: ./build/KeypointSubscriber [소켓 경로]
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "utils/KeypointProtocol.h"
+
+namespace {
+    volatile std::sig_atomic_t running = 1;
+
+    void handleSignal(int) {
+        running = 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    using namespace Utils;
+
+    std::string socketPath = argc > 1 ? argv[1] : "/tmp/realposesense.sock";
+
+    int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        std::cerr << "소켓 생성 실패: " << std::strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    // 이전 실행에서 남은 소켓 파일 제거 후 바인딩
+    unlink(socketPath.c_str());
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0) {
+        std::cerr << "소켓 바인딩 실패 (" << socketPath << "): " << std::strerror(errno) << std::endl;
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    std::cout << "키포인트 수신 대기 중: " << socketPath << std::endl;
+
+    std::vector<char> buffer(KeypointProtocol::MAX_PACKET_SIZE);
+    uint64_t lastFrame = 0;
+    uint64_t gapCount = 0;
+
+    while (running) {
+        ssize_t received = recv(fd, buffer.data(), buffer.size(), 0);
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "수신 오류: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        if (received < static_cast<ssize_t>(sizeof(KeypointProtocol::Header))) {
+            continue;
+        }
+
+        KeypointProtocol::Header header;
+        std::memcpy(&header, buffer.data(), sizeof(header));
+        if (header.magic != KeypointProtocol::MAGIC || header.version != KeypointProtocol::VERSION) {
+            std::cerr << "알 수 없는 패킷 무시" << std::endl;
+            continue;
+        }
+
+        bool has3d = (header.flags & KeypointProtocol::FLAG_HAS_3D) != 0;
+        size_t pointCount = static_cast<size_t>(header.numPersons) * header.numKeypoints;
+        size_t expected = sizeof(header) + pointCount * sizeof(KeypointProtocol::Point2D)
+                        + (has3d ? pointCount * sizeof(KeypointProtocol::Point3D) : 0);
+        if (static_cast<size_t>(received) < expected) {
+            std::cerr << "잘린 패킷 무시 (frame " << header.frameNumber << ")" << std::endl;
+            continue;
+        }
+
+        // 발행자 측에서 드롭된 프레임 수 추적
+        if (lastFrame != 0 && header.frameNumber > lastFrame + 1) {
+            gapCount += header.frameNumber - lastFrame - 1;
+        }
+        lastFrame = header.frameNumber;
+
+        const char* points2d = buffer.data() + sizeof(header);
+        const char* points3d = points2d + pointCount * sizeof(KeypointProtocol::Point2D);
+
+        std::cout << "camera " << header.cameraIndex << ", frame " << header.frameNumber
+                  << ", persons " << header.numPersons
+                  << ", keypoints " << header.numKeypoints << ", gaps " << gapCount << std::endl;
+
+        for (int p = 0; p < header.numPersons; p++) {
+            for (int k = 0; k < header.numKeypoints; k++) {
+                size_t index = static_cast<size_t>(p) * header.numKeypoints + k;
+                KeypointProtocol::Point2D point;
+                std::memcpy(&point, points2d + index * sizeof(point), sizeof(point));
+                if (point.x < 0 || point.y < 0) continue;
+
+                std::cout << "  [" << p << ":" << std::setw(2) << k << "] (" << point.x << ", " << point.y << ")";
+                if (has3d) {
+                    KeypointProtocol::Point3D point3d;
+                    std::memcpy(&point3d, points3d + index * sizeof(point3d), sizeof(point3d));
+                    std::cout << std::fixed << std::setprecision(3)
+                              << " -> (" << point3d.x << ", " << point3d.y << ", " << point3d.z << ") m";
+                }
+                std::cout << std::endl;
+            }
+        }
+    }
+
+    close(fd);
+    unlink(socketPath.c_str());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+// 공유 메모리 프레임 링의 참조 소비자
+// 사용법: ./build/SharedRingReader [공유 메모리 이름] [latest]
+//  - latest를 지정하면 항상 최신 프레임만 읽음 (저지연), 아니면 순차적으로 읽고 오버런을 집계
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <csignal>
+#include <cstdlib>
+#include "utils/SharedFrameRing.h"
+
+namespace {
+    volatile std::sig_atomic_t running = 1;
+
+    void handleSignal(int) {
+        running = 0;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    using namespace Utils;
+
+    std::string name = argc > 1 ? argv[1] : "/realposesense";
+    bool latestOnly = argc > 2 && std::string(argv[2]) == "latest";
+
+    SharedFrameRing::Reader reader(name);
+    if (!reader.attach()) {
+        return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    const SharedFrameRing::RingHeader* header = reader.getHeader();
+    std::cout << "연결됨: " << name << " (" << header->slotCount << " 슬롯, 컬러 "
+              << header->colorWidth << "x" << header->colorHeight << ", 깊이 "
+              << header->depthWidth << "x" << header->depthHeight << ")" << std::endl;
+
+    uint64_t tornCount = 0;
+    while (running) {
+        SharedFrameRing::FrameView view;
+        bool acquired = latestOnly ? reader.acquireLatest(view) : reader.acquireNext(view);
+        if (!acquired) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        // 슬롯 메모리를 직접 참조 (복사 없음) - 예: 중앙 픽셀 깊이
+        size_t center = static_cast<size_t>(header->depthHeight / 2) * header->depthWidth + header->depthWidth / 2;
+        float centerDepth = view.depth[center] * header->depthScale;
+        uint64_t frameNumber = view.slot->frameNumber;
+        uint32_t numPersons = view.slot->numPersons;
+        int64_t publishTimeUs = view.slot->publishTimeUs;
+
+        // 사용 중 생산자가 슬롯을 덮어썼으면 결과 폐기
+        if (!reader.validate(view)) {
+            tornCount++;
+            continue;
+        }
+
+        int64_t nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        std::cout << "seq " << view.sequence << ", frame " << frameNumber
+                  << ", persons " << numPersons
+                  << ", center " << std::fixed << std::setprecision(2) << centerDepth << "m"
+                  << ", age " << std::setprecision(1) << (nowUs - publishTimeUs) / 1000.0 << "ms"
+                  << ", overruns " << reader.getOverrunCount() << ", torn " << tornCount << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
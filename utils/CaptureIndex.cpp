@@ -0,0 +1,107 @@
+#include "CaptureIndex.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace Utils {
+    namespace CaptureIndex {
+        namespace {
+            // 캡처 파일 접두사의 파일명 부분 (예: 12 → "000012_")
+            std::string captureFileStem(int captureNumber) {
+                std::stringstream ss;
+                ss << std::setw(6) << std::setfill('0') << captureNumber << "_";
+                return ss.str();
+            }
+
+            // 저장 세션 색인(index.csv)의 캡처 파일 접두사 추가 (세션 디렉토리 기준 상대 경로 -> 전체 경로)
+            void appendSessionCaptures(const std::string& indexPath, std::vector<std::string>& sources) {
+                std::ifstream index(indexPath);
+                std::string sessionDir = indexPath.substr(0, indexPath.size() - std::string("index.csv").size());
+                std::string line;
+                while (std::getline(index, line)) {
+                    Entry entry;
+                    if (parseIndexLine(line, entry)) {
+                        sources.push_back(sessionDir + entry.prefix);
+                    }
+                }
+            }
+        }
+
+        bool parseIndexLine(const std::string& line, Entry& entry) {
+            std::string text = line;
+            if (!text.empty() && text.back() == '\r') {
+                text.pop_back();
+            }
+            std::vector<std::string> fields;
+            std::stringstream ss(text);
+            std::string field;
+            while (std::getline(ss, field, ',')) {
+                fields.push_back(field);
+            }
+            if (fields.size() != 4 || fields[0].empty() || fields[1].empty() || fields[2].empty()) {
+                return false;
+            }
+
+            char* end = nullptr;
+            long capture = std::strtol(fields[0].c_str(), &end, 10);
+            if (*end != '\0' || capture < 0) return false;
+            unsigned long long frameNumber = std::strtoull(fields[1].c_str(), &end, 10);
+            if (*end != '\0') return false;
+            double timestampMs = std::strtod(fields[2].c_str(), &end);
+            if (*end != '\0') return false;
+
+            // 접두사는 "shard_NNNN/<캡처 번호>_" - 마지막 필드가 잘렸으면 번호와 맞지 않음
+            std::string stem = captureFileStem(static_cast<int>(capture));
+            const std::string& prefix = fields[3];
+            if (prefix.size() <= stem.size() || prefix.compare(prefix.size() - stem.size(), stem.size(), stem) != 0 ||
+                prefix[prefix.size() - stem.size() - 1] != '/') {
+                return false;
+            }
+            entry.capture = static_cast<int>(capture);
+            entry.frameNumber = frameNumber;
+            entry.timestampMs = timestampMs;
+            entry.prefix = prefix;
+            return true;
+        }
+
+        std::vector<std::string> findCaptures(const std::string& inputDir) {
+            std::vector<std::string> sources;
+
+            std::vector<cv::String> indexFiles;
+            cv::glob(inputDir + "/index.csv", indexFiles, true);
+            for (const cv::String& indexFile : indexFiles) {
+                appendSessionCaptures(indexFile, sources);
+            }
+
+            std::vector<cv::String> files;
+            cv::glob(inputDir + "/color.png", files, true);
+            for (const cv::String& file : files) {
+                std::string path = file;
+                sources.push_back(path.substr(0, path.size() - std::string("color.png").size()));
+            }
+
+            std::sort(sources.begin(), sources.end());
+            sources.erase(std::unique(sources.begin(), sources.end()), sources.end());
+            return sources;
+        }
+
+        bool readDepthBin(const std::string& path, cv::Mat& depth) {
+            std::ifstream file(path, std::ios::binary);
+            if (!file) {
+                return false;
+            }
+            int width = 0;
+            int height = 0;
+            file.read(reinterpret_cast<char*>(&width), sizeof(int));
+            file.read(reinterpret_cast<char*>(&height), sizeof(int));
+            if (!file || width <= 0 || height <= 0 || width > 4096 || height > 4096) {
+                return false;
+            }
+            depth.create(height, width, CV_32FC1);
+            file.read(reinterpret_cast<char*>(depth.data), static_cast<std::streamsize>(depth.total() * sizeof(float)));
+            return static_cast<bool>(file);
+        }
+    }
+}
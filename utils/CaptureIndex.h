@@ -0,0 +1,32 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Utils {
+    // 저장된 캡처(ImageSaver 출력) 목록/파일 읽기 - 오프라인 도구 공용
+    namespace CaptureIndex {
+        // 저장 세션 색인(index.csv) 한 줄 - capture,frame_number,timestamp_ms,prefix
+        struct Entry {
+            int capture;
+            uint64_t frameNumber;
+            double timestampMs;
+            std::string prefix; // 세션 디렉토리 기준 상대 접두사 (예: shard_0000/000012_)
+        };
+
+        // 색인 한 줄 해석 (ImageSaver 이어서 저장과 오프라인 도구 공용)
+        // - 헤더, 필드가 4개가 아니거나 숫자가 아닌 줄, 접두사가 캡처 번호와 맞지 않는 줄(기록 도중 잘린 줄)은 false
+        bool parseIndexLine(const std::string& line, Entry& entry);
+
+        // 디렉토리 아래 모든 캡처의 파일 접두사 - 접두사 + "color.png", "depth.bin", "depth_intrinsics.yml"이 한 캡처
+        // - 세션 레이아웃: 색인(index.csv)에 기록된 캡처만 (파일 탐색 없이)
+        // - 이전 resultN/ 레이아웃: color.png가 있는 폴더
+        // - 경로 순 정렬 (실행할 때마다 순서가 같음)
+        std::vector<std::string> findCaptures(const std::string& inputDir);
+
+        // DepthProcessor::saveDepthToBin 형식 읽기 (int width, int height, width*height개 float 미터 → CV_32FC1)
+        bool readDepthBin(const std::string& path, cv::Mat& depth);
+    }
+}
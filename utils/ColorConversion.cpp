@@ -0,0 +1,106 @@
+#include "ColorConversion.h"
+#include "FramePool.h"
+#include <vector>
+#include <algorithm>
+
+namespace Utils {
+    namespace ColorConversion {
+
+        namespace {
+            // 출력 좌표 하나가 참조하는 원본 두 위치와 두 번째 위치의 가중치
+            struct Tap {
+                int first;
+                int second;
+                float weight;
+            };
+
+            void buildTaps(int srcSize, int dstSize, std::vector<Tap>& taps) {
+                taps.resize(dstSize);
+                float ratio = static_cast<float>(srcSize) / dstSize;
+                for (int d = 0; d < dstSize; d++) {
+                    float s = (d + 0.5f) * ratio - 0.5f;
+                    if (s < 0.0f) s = 0.0f;
+                    int first = std::min(static_cast<int>(s), srcSize - 1);
+                    taps[d].first = first;
+                    taps[d].second = std::min(first + 1, srcSize - 1);
+                    taps[d].weight = s - first;
+                }
+            }
+
+            inline float clampByte(float value) {
+                return value < 0.0f ? 0.0f : (value > 255.0f ? 255.0f : value);
+            }
+        }
+
+        void yuyvToTensor(const cv::Mat& yuyv, int dstWidth, int dstHeight, const Normalization& norm, float* dst) {
+            CV_Assert(yuyv.type() == CV_8UC2 && yuyv.cols % 2 == 0);
+
+            // 크기가 바뀔 때만 다시 계산 (추론 스레드 전용)
+            thread_local std::vector<Tap> columns;
+            thread_local std::vector<Tap> rows;
+            thread_local int cachedSrc[2] = {0, 0};
+            thread_local int cachedDst[2] = {0, 0};
+            if (cachedSrc[0] != yuyv.cols || cachedSrc[1] != yuyv.rows || cachedDst[0] != dstWidth || cachedDst[1] != dstHeight) {
+                buildTaps(yuyv.cols, dstWidth, columns);
+                buildTaps(yuyv.rows, dstHeight, rows);
+                cachedSrc[0] = yuyv.cols;
+                cachedSrc[1] = yuyv.rows;
+                cachedDst[0] = dstWidth;
+                cachedDst[1] = dstHeight;
+            }
+
+            const size_t plane = static_cast<size_t>(dstWidth) * dstHeight;
+            float* dstR = dst;
+            float* dstG = dst + plane;
+            float* dstB = dst + 2 * plane;
+
+            for (int dy = 0; dy < dstHeight; dy++) {
+                const Tap& row = rows[dy];
+                const uint8_t* top = yuyv.ptr<uint8_t>(row.first);
+                const uint8_t* bottom = yuyv.ptr<uint8_t>(row.second);
+                float wy = row.weight;
+                size_t outRow = static_cast<size_t>(dy) * dstWidth;
+
+                for (int dx = 0; dx < dstWidth; dx++) {
+                    const Tap& col = columns[dx];
+                    // YUYV: 두 픽셀이 [Y0 U Y1 V] 4바이트를 공유 - 휘도는 픽셀별, 색차는 짝 단위
+                    int y0 = col.first * 2;
+                    int y1 = col.second * 2;
+                    int c0 = (col.first & ~1) * 2;
+                    int c1 = (col.second & ~1) * 2;
+                    float wx = col.weight;
+
+                    float yTop = top[y0] + (top[y1] - top[y0]) * wx;
+                    float yBottom = bottom[y0] + (bottom[y1] - bottom[y0]) * wx;
+                    float uTop = top[c0 + 1] + (top[c1 + 1] - top[c0 + 1]) * wx;
+                    float uBottom = bottom[c0 + 1] + (bottom[c1 + 1] - bottom[c0 + 1]) * wx;
+                    float vTop = top[c0 + 3] + (top[c1 + 3] - top[c0 + 3]) * wx;
+                    float vBottom = bottom[c0 + 3] + (bottom[c1 + 3] - bottom[c0 + 3]) * wx;
+
+                    float luma = 1.164f * (yTop + (yBottom - yTop) * wy - 16.0f);
+                    float u = uTop + (uBottom - uTop) * wy - 128.0f;
+                    float v = vTop + (vBottom - vTop) * wy - 128.0f;
+
+                    float r = clampByte(luma + 1.596f * v);
+                    float g = clampByte(luma - 0.813f * v - 0.391f * u);
+                    float b = clampByte(luma + 2.018f * u);
+
+                    size_t out = outRow + dx;
+                    dstR[out] = (r - norm.offset[0]) * norm.scale[0];
+                    dstG[out] = (g - norm.offset[1]) * norm.scale[1];
+                    dstB[out] = (b - norm.offset[2]) * norm.scale[2];
+                }
+            }
+        }
+
+        cv::Mat toBgr(const cv::Mat& image) {
+            if (image.type() != CV_8UC2) {
+                return image;
+            }
+            cv::Mat bgr = FramePool::instance().attach();
+            cv::cvtColor(image, bgr, cv::COLOR_YUV2BGR_YUYV);
+            return bgr;
+        }
+
+    } // namespace ColorConversion
+} // namespace Utils
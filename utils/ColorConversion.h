@@ -0,0 +1,23 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+namespace Utils {
+    namespace ColorConversion {
+
+        // 모델 입력 정규화 계수 (RGB 채널 순서): out[c] = (value[c] - offset[c]) * scale[c]
+        struct Normalization {
+            float offset[3];
+            float scale[3];
+        };
+
+        // YUYV(YUY2, CV_8UC2) 프레임을 한 번의 순회로 모델 입력 텐서(RGB, CHW, float)로 변환
+        // - YUV->RGB(BT.601 제한 범위, librealsense/OpenCV와 같은 계수), 양선형 축소/확대(cv::resize INTER_LINEAR와
+        //   같은 픽셀 중심 정렬), 정규화, 채널 분리를 함께 처리하므로 중간 BGR/리사이즈 영상이 없음
+        void yuyvToTensor(const cv::Mat& yuyv, int dstWidth, int dstHeight, const Normalization& norm, float* dst);
+
+        // 표시/저장용 BGR 영상 - 이미 3채널이면 변환 없이 그대로 반환 (데이터 공유), YUYV 변환 결과는 프레임 풀 버퍼
+        cv::Mat toBgr(const cv::Mat& image);
+
+    } // namespace ColorConversion
+} // namespace Utils
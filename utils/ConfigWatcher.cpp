@@ -0,0 +1,112 @@
+#include "ConfigWatcher.h"
+#include <iostream>
+#include <chrono>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace Utils {
+    namespace {
+        // 연속 쓰기(잘라내기 후 기록 등)를 한 번의 변경으로 묶는 대기 시간
+        const int DEBOUNCE_MS = 100;
+    }
+
+    ConfigWatcher::ConfigWatcher(const std::string& path, const AppConfig& initial)
+        : path(path), current(std::make_shared<const AppConfig>(initial)), version(0), inotifyFd(-1), running(false) {
+        size_t slash = path.find_last_of('/');
+        directory = slash == std::string::npos ? "." : path.substr(0, slash);
+        fileName = slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+    ConfigWatcher::~ConfigWatcher() {
+        stop();
+    }
+
+    bool ConfigWatcher::start() {
+        if (running) return true;
+        inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd < 0) {
+            std::cerr << "설정 파일 감시를 시작할 수 없습니다 (inotify_init1 실패)" << std::endl;
+            return false;
+        }
+        if (inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+            std::cerr << "설정 디렉토리를 감시할 수 없습니다: " << directory << std::endl;
+            close(inotifyFd);
+            inotifyFd = -1;
+            return false;
+        }
+        running = true;
+        watchThread = std::thread(&ConfigWatcher::watch, this);
+        std::cout << "설정 파일 감시 시작: " << path << std::endl;
+        return true;
+    }
+
+    void ConfigWatcher::stop() {
+        running = false;
+        if (watchThread.joinable()) {
+            watchThread.join();
+        }
+        if (inotifyFd >= 0) {
+            close(inotifyFd);
+            inotifyFd = -1;
+        }
+    }
+
+    std::shared_ptr<const AppConfig> ConfigWatcher::snapshot() const {
+        return std::atomic_load(&current);
+    }
+
+    uint64_t ConfigWatcher::getVersion() const {
+        return version.load(std::memory_order_acquire);
+    }
+
+    void ConfigWatcher::watch() {
+        alignas(inotify_event) char buffer[4096];
+        bool pending = false;
+        auto changedAt = std::chrono::steady_clock::now();
+
+        while (running) {
+            pollfd fds;
+            fds.fd = inotifyFd;
+            fds.events = POLLIN;
+            fds.revents = 0;
+            int ready = poll(&fds, 1, pending ? DEBOUNCE_MS : 200);
+
+            if (ready > 0) {
+                // 같은 디렉토리의 다른 파일 이벤트는 무시
+                ssize_t length;
+                while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+                    for (char* ptr = buffer; ptr < buffer + length;) {
+                        const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+                        if (event->len > 0 && fileName == event->name) {
+                            pending = true;
+                            changedAt = std::chrono::steady_clock::now();
+                        }
+                        ptr += sizeof(inotify_event) + event->len;
+                    }
+                }
+                continue;
+            }
+
+            if (pending && std::chrono::steady_clock::now() - changedAt >= std::chrono::milliseconds(DEBOUNCE_MS)) {
+                pending = false;
+                reload();
+            }
+        }
+    }
+
+    void ConfigWatcher::reload() {
+        AppConfig next;
+        if (!ConfigManager::loadConfig(path, next)) {
+            std::cerr << "설정 파일을 다시 읽지 못했습니다. 이전 설정을 유지합니다." << std::endl;
+            return;
+        }
+        if (!ConfigManager::validateConfig(next)) {
+            std::cerr << "설정 검증 실패. 이전 설정을 유지합니다." << std::endl;
+            return;
+        }
+        std::atomic_store(&current, std::shared_ptr<const AppConfig>(std::make_shared<const AppConfig>(next)));
+        uint64_t published = version.fetch_add(1, std::memory_order_release) + 1;
+        std::cout << "설정 파일 변경 감지: 새 설정 적용 (버전 " << published << ")" << std::endl;
+    }
+}
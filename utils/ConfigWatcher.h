@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include "../ConfigManager.h"
+
+namespace Utils {
+    // 설정 파일 변경 감시 (inotify) - 다시 읽어 검증한 뒤 불변 스냅샷으로 교체
+    // - 편집기의 임시 파일 저장 후 이름 바꾸기에도 대응하도록 파일이 아닌 상위 디렉토리를 감시
+    // - 읽기 실패/검증 실패 시 이전 스냅샷 유지
+    // - 처리 스레드는 프레임 경계에서 getVersion()만 비교하고 (원자 변수, 잠금 없음) 바뀐 경우에만 snapshot() 호출
+    class ConfigWatcher {
+    public:
+        ConfigWatcher(const std::string& path, const AppConfig& initial);
+        ~ConfigWatcher();
+
+        // 감시 스레드 시작 (inotify 초기화 실패 시 false)
+        bool start();
+
+        // 감시 스레드 종료
+        void stop();
+
+        // 현재 스냅샷 (호출자가 보관하는 동안 유효)
+        std::shared_ptr<const AppConfig> snapshot() const;
+
+        // 스냅샷 교체 횟수 (0이면 시작 설정 그대로)
+        uint64_t getVersion() const;
+
+    private:
+        void watch();
+        void reload();
+
+        std::string path;
+        std::string directory;
+        std::string fileName;
+        std::shared_ptr<const AppConfig> current; // std::atomic_load/atomic_store로만 접근
+        std::atomic<uint64_t> version;
+        int inotifyFd;
+        std::atomic<bool> running;
+        std::thread watchThread;
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+// x86_64 AVX2 커널은 빌드 옵션(-mavx2) 대신 함수 단위 target 속성으로 컴파일하고 실행 시 CPU 지원 여부로 선택
+// - 기본 빌드가 AVX2 미지원 CPU에서도 SIGILL 없이 동작 (스칼라 경로로 대체)
+// - ENABLE_AVX2=OFF면 AVX2 커널 자체를 빌드하지 않음, -mavx2로 빌드하면 검사 없이 항상 AVX2
+#if defined(ENABLE_AVX2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTILS_HAVE_AVX2_KERNELS 1
+#define UTILS_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace Utils {
+    namespace CpuFeatures {
+
+#if defined(UTILS_HAVE_AVX2_KERNELS)
+        // 현재 CPU의 AVX2 지원 여부 (첫 호출 때 한 번 검사)
+        inline bool hasAvx2() {
+#if defined(__AVX2__)
+            return true;
+#else
+            static const bool supported = [] {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") != 0;
+            }();
+            return supported;
+#endif
+        }
+#endif
+
+    } // namespace CpuFeatures
+} // namespace Utils
@@ -0,0 +1,294 @@
+#include "DisplayThread.h"
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include "ColorConversion.h"
+#include "../PoseEstimator.h"
+#include "../DepthProcessor.h"
+
+namespace Utils {
+    namespace {
+        const std::string POSE_WINDOW_NAME = "Pose Estimation";
+        const std::string DEPTH_WINDOW_NAME = "Enhanced Depth";
+        const std::string COMPOSITE_WINDOW_NAME = "RealPoseSense";
+
+        const cv::Scalar TEXT_COLOR(0, 255, 0);
+        const cv::Scalar DEPTH_TEXT_COLOR(255, 255, 255);
+        const int LABEL_PADDING = 3;
+        const int LINE_HEIGHT = 20;
+        const int STATIC_BACKGROUND_ALPHA = 96; // 정적 문구 배경 상자 불투명도 (0~255)
+
+        int64_t nowUs() {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // 기존 putText 위치(기준선 y = 20, 40, ...)와 같은 줄에 오도록 문구 왼쪽 위 좌표 계산
+        cv::Point lineOrigin(int line, const cv::Mat& label) {
+            return cv::Point(10 - LABEL_PADDING, LINE_HEIGHT * (line + 1) - label.rows + LABEL_PADDING);
+        }
+    }
+
+    DisplayThread::DisplayThread(const AppConfig& config)
+        : config(config),
+          frameIntervalUs(config.display.max_fps > 0 ? static_cast<int64_t>(1000000.0 / config.display.max_fps) : 0),
+          hasPending(false), nextFrameUs(0), lastKey(0), stopping(false), running(false) {
+        // 정적 문구는 한 번만 렌더링
+        renderLabel(controlsLabel, "s: Save, q: Quit", 0.4, TEXT_COLOR, STATIC_BACKGROUND_ALPHA);
+    }
+
+    DisplayThread::~DisplayThread() {
+        stop();
+    }
+
+    void DisplayThread::start() {
+        if (running) return;
+        stopping = false;
+        running = true;
+        thread = std::thread(&DisplayThread::run, this);
+    }
+
+    void DisplayThread::stop() {
+        if (!running) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_one();
+        thread.join();
+        running = false;
+    }
+
+    bool DisplayThread::wantsFrame() const {
+        return running && !hasPending.load(std::memory_order_acquire) &&
+               nowUs() >= nextFrameUs.load(std::memory_order_relaxed);
+    }
+
+    void DisplayThread::submit(const std::vector<View>& views, const FPSCounter::Stats& stats,
+                               const FrameTiming::Breakdown* latency, float depthRangeMin, float depthRangeMax) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            size_t count = views.size();
+            pending.viewCount = count;
+            if (pending.colors.size() < count) {
+                pending.colors.resize(count);
+                pending.depths.resize(count);
+                pending.poses.resize(count);
+                pending.centerDists.resize(count);
+            }
+            for (size_t i = 0; i < count; i++) {
+                // 컬러는 카메라 프레임 버퍼라 복사 (슬롯 버퍼 재사용), 깊이 시각화는 프레임마다 새로 만든 영상이라 참조만
+                views[i].color.copyTo(pending.colors[i]);
+                pending.depths[i] = views[i].depth;
+                if (views[i].pose) {
+                    pending.poses[i] = *views[i].pose;
+                } else {
+                    pending.poses[i].reset(0, 0, views[i].color.cols, views[i].color.rows, 0.0f);
+                }
+                pending.centerDists[i] = views[i].centerDist;
+            }
+            pending.stats = stats;
+            pending.hasLatency = latency != nullptr;
+            if (latency) {
+                pending.latency = *latency;
+            }
+            pending.depthRangeMin = depthRangeMin;
+            pending.depthRangeMax = depthRangeMax;
+            hasPending.store(true, std::memory_order_release);
+        }
+        nextFrameUs.store(nowUs() + frameIntervalUs, std::memory_order_relaxed);
+        condition.notify_one();
+    }
+
+    char DisplayThread::takeKey() {
+        return static_cast<char>(lastKey.exchange(0));
+    }
+
+    void DisplayThread::run() {
+        if (config.display.composite) {
+            cv::namedWindow(COMPOSITE_WINDOW_NAME, cv::WINDOW_AUTOSIZE);
+        } else {
+            cv::namedWindow(POSE_WINDOW_NAME, cv::WINDOW_AUTOSIZE);
+            cv::namedWindow(DEPTH_WINDOW_NAME, cv::WINDOW_AUTOSIZE);
+        }
+
+        while (true) {
+            bool haveFrame = false;
+            {
+                // 새 프레임이 없어도 창 이벤트는 계속 처리 (응답 없음 방지)
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait_for(lock, std::chrono::milliseconds(10),
+                                   [this] { return stopping || hasPending.load(std::memory_order_acquire); });
+                if (stopping) break;
+                if (hasPending.load(std::memory_order_acquire)) {
+                    std::swap(pending, working);
+                    hasPending.store(false, std::memory_order_release);
+                    haveFrame = true;
+                }
+            }
+
+            if (haveFrame) {
+                render(working);
+            }
+
+            int key = cv::waitKey(1);
+            if (key >= 0) {
+                lastKey.store(key & 0xFF);
+            }
+        }
+
+        cv::destroyAllWindows();
+    }
+
+    void DisplayThread::render(Slot& slot) {
+        size_t count = slot.viewCount;
+        if (count == 0) return;
+
+        // 모든 뷰가 공유하는 동적 문구 (표시 정밀도에서 값이 바뀔 때만 다시 렌더링)
+        const FPSCounter::Stats& stats = slot.stats;
+        if (changed(fpsLabel, {stats.fps}, 10.0)) {
+            std::stringstream ss;
+            ss << "FPS: " << std::fixed << std::setprecision(1) << stats.fps;
+            renderLabel(fpsLabel, ss.str(), 0.5, TEXT_COLOR, 0);
+        }
+        if (changed(tailLabel, {stats.p50Ms, stats.p99Ms, stats.maxMs}, 10.0)) {
+            std::stringstream ss;
+            ss << "Frame p50/p99/max: " << std::fixed << std::setprecision(1)
+               << stats.p50Ms << "/" << stats.p99Ms << "/" << stats.maxMs << "ms";
+            renderLabel(tailLabel, ss.str(), 0.5, TEXT_COLOR, 0);
+        }
+        const FrameTiming::Breakdown& latency = slot.latency;
+        bool showLatency = slot.hasLatency && latency.endToEndMs >= 0.0;
+        double procMs = latency.depthMs + latency.poseMs + latency.renderMs;
+        if (showLatency && changed(latencyLabel, {latency.endToEndMs, latency.sensorToArrivalMs, latency.arrivalToAcquireMs, procMs}, 10.0)) {
+            // 센서→결과 지연 (USB/큐 대기 구간과 처리 구간 분리)
+            std::stringstream ss;
+            ss << "E2E: " << std::fixed << std::setprecision(1) << latency.endToEndMs << "ms (";
+            if (latency.sensorToArrivalMs >= 0.0) {
+                ss << "usb " << latency.sensorToArrivalMs << ", ";
+            }
+            ss << "queue " << latency.arrivalToAcquireMs << ", proc " << procMs << ")";
+            renderLabel(latencyLabel, ss.str(), 0.5, TEXT_COLOR, 0);
+        }
+
+        if (changed(depthRangeLabel, {slot.depthRangeMin, slot.depthRangeMax}, 100.0)) {
+            std::stringstream ss;
+            ss << std::fixed << std::setprecision(2) << slot.depthRangeMin << "m ~ " << slot.depthRangeMax << "m";
+            renderLabel(depthRangeLabel, ss.str(), 0.5, DEPTH_TEXT_COLOR, STATIC_BACKGROUND_ALPHA);
+        }
+
+        if (distanceLabels.size() < count) distanceLabels.resize(count);
+        poseViews.resize(count);
+        depthViews.resize(count);
+
+        for (size_t i = 0; i < count; i++) {
+            // YUYV 원본은 표시할 때만 BGR로 변환 (BGR이면 슬롯 버퍼에 바로 그림)
+            cv::Mat& pose = poseViews[i];
+            pose = ColorConversion::toBgr(slot.colors[i]);
+            PoseEstimator::drawKeypoints(pose, slot.poses[i]);
+            DepthProcessor::drawCrosshair(pose, 5, TEXT_COLOR);
+
+            if (changed(distanceLabels[i], {slot.centerDists[i]}, 100.0)) {
+                std::stringstream ss;
+                ss << "Distance: " << std::fixed << std::setprecision(2) << slot.centerDists[i] << "m";
+                renderLabel(distanceLabels[i], ss.str(), 0.5, TEXT_COLOR, 0);
+            }
+            blendLabel(pose, fpsLabel, lineOrigin(0, fpsLabel.image));
+            blendLabel(pose, tailLabel, lineOrigin(1, tailLabel.image));
+            blendLabel(pose, distanceLabels[i], lineOrigin(2, distanceLabels[i].image));
+            if (showLatency) {
+                blendLabel(pose, latencyLabel, lineOrigin(3, latencyLabel.image));
+            }
+            blendLabel(pose, controlsLabel, cv::Point(10 - LABEL_PADDING, pose.rows - controlsLabel.image.rows - 2));
+
+            // 깊이 시각화는 처리 루프와 공유하므로 복사 후 그림 (없으면 검은 화면)
+            cv::Mat& depth = depthViews[i];
+            if (slot.depths[i].empty()) {
+                depth.create(pose.rows, pose.cols, CV_8UC3);
+                depth.setTo(cv::Scalar::all(0));
+            } else {
+                slot.depths[i].copyTo(depth);
+            }
+            blendLabel(depth, depthRangeLabel, lineOrigin(0, depthRangeLabel.image));
+        }
+
+        // 다중 카메라 뷰는 가로로 연결 (설정상 모든 카메라가 같은 스트림 해상도 사용)
+        if (count == 1) {
+            poseMosaic = poseViews[0];
+            depthMosaic = depthViews[0];
+        } else {
+            cv::hconcat(poseViews, poseMosaic);
+            cv::hconcat(depthViews, depthMosaic);
+        }
+
+        if (config.display.composite) {
+            // 깊이 해상도가 다르면 (데시메이션 등) 포즈 뷰 높이에 맞춤
+            if (depthMosaic.rows != poseMosaic.rows) {
+                double scale = static_cast<double>(poseMosaic.rows) / depthMosaic.rows;
+                cv::resize(depthMosaic, depthMosaic, cv::Size(), scale, scale, cv::INTER_NEAREST);
+            }
+            cv::hconcat(poseMosaic, depthMosaic, composite);
+            cv::imshow(COMPOSITE_WINDOW_NAME, composite);
+        } else {
+            cv::imshow(POSE_WINDOW_NAME, poseMosaic);
+            cv::imshow(DEPTH_WINDOW_NAME, depthMosaic);
+        }
+    }
+
+    bool DisplayThread::changed(Label& label, std::initializer_list<double> values, double precision) {
+        bool differs = label.image.empty() || label.keys.size() != values.size();
+        label.keys.resize(values.size());
+        size_t i = 0;
+        for (double value : values) {
+            long long key = std::llround(value * precision);
+            if (label.keys[i] != key) {
+                label.keys[i] = key;
+                differs = true;
+            }
+            i++;
+        }
+        return differs;
+    }
+
+    void DisplayThread::renderLabel(Label& label, const std::string& text, double scale, const cv::Scalar& color,
+                                    int backgroundAlpha) {
+        int baseline = 0;
+        cv::Size textSize = cv::getTextSize(text, cv::FONT_HERSHEY_SIMPLEX, scale, 1, &baseline);
+
+        label.image.create(textSize.height + baseline + 2 * LABEL_PADDING, textSize.width + 2 * LABEL_PADDING, CV_8UC3);
+        label.image.setTo(cv::Scalar::all(0));
+        cv::putText(label.image, text, cv::Point(LABEL_PADDING, LABEL_PADDING + textSize.height),
+                    cv::FONT_HERSHEY_SIMPLEX, scale, color, 1);
+
+        // 글자 픽셀은 불투명, 나머지는 배경 상자 불투명도
+        cv::Mat gray;
+        cv::cvtColor(label.image, gray, cv::COLOR_BGR2GRAY);
+        label.alpha.create(label.image.size(), CV_8UC1);
+        label.alpha.setTo(cv::Scalar(backgroundAlpha));
+        label.alpha.setTo(cv::Scalar(255), gray > 0);
+    }
+
+    void DisplayThread::blendLabel(cv::Mat& target, const Label& label, cv::Point origin) {
+        if (label.image.empty()) return;
+        cv::Rect area = cv::Rect(origin, label.image.size()) & cv::Rect(0, 0, target.cols, target.rows);
+        if (area.area() == 0) return;
+
+        for (int y = area.y; y < area.y + area.height; y++) {
+            const cv::Vec3b* src = label.image.ptr<cv::Vec3b>(y - origin.y) + (area.x - origin.x);
+            const uint8_t* alpha = label.alpha.ptr<uint8_t>(y - origin.y) + (area.x - origin.x);
+            cv::Vec3b* dst = target.ptr<cv::Vec3b>(y) + area.x;
+            for (int x = 0; x < area.width; x++) {
+                int a = alpha[x];
+                if (a == 0) continue;
+                if (a == 255) {
+                    dst[x] = src[x];
+                    continue;
+                }
+                for (int c = 0; c < 3; c++) {
+                    dst[x][c] = static_cast<uint8_t>((dst[x][c] * (255 - a) + src[x][c] * a + 127) / 255);
+                }
+            }
+        }
+    }
+}
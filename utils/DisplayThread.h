@@ -0,0 +1,114 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../ConfigManager.h"
+#include "../PoseResult.h"
+#include "FPSCounter.h"
+#include "FrameTiming.h"
+
+namespace Utils {
+    // HighGUI 표시 전용 스레드 - 처리 루프는 프레임을 넘기기만 하고 그리기/imshow/waitKey는 모두 이 스레드에서 실행
+    // - display.max_fps 상한: 다음 표시 시각 전이거나 이전 프레임을 아직 가져가지 않았으면 wantsFrame()이 false
+    //   (처리 루프는 이때 깊이 시각화와 프레임 복사를 모두 건너뜀 - 표시가 추론 속도를 늦추지 않음)
+    // - 정적 문구(조작 안내)는 한 번만 그려 두고 알파 블렌딩, 동적 문구(깊이 범위 포함)는 표시 값이 바뀔 때만 다시 그림
+    // - display.composite: 포즈/깊이 뷰를 한 창에 나란히 표시
+    class DisplayThread {
+    public:
+        // 카메라 뷰 하나 (color는 BGR 또는 YUYV 원본, depth는 시각화된 깊이 - 비어 있으면 검은 화면)
+        struct View {
+            cv::Mat color;
+            cv::Mat depth;
+            const PoseResult* pose;
+            float centerDist;
+        };
+
+        DisplayThread(const AppConfig& config);
+        ~DisplayThread();
+
+        // 표시 스레드 시작 (창 생성 포함)
+        void start();
+
+        // 표시 스레드 종료 및 창 닫기
+        void stop();
+
+        // 이번 프레임을 제출할 차례인지 (갱신 주기 상한 + 이전 프레임 소비 여부)
+        bool wantsFrame() const;
+
+        // 프레임 제출 - 컬러는 복사(카메라 버퍼 반환 대비), 깊이는 참조만 유지하고 즉시 반환
+        // - depthRange: 깊이 뷰에 표시할 범위 (설정 핫 리로드로 바뀔 수 있어 프레임마다 전달)
+        void submit(const std::vector<View>& views, const FPSCounter::Stats& stats, const FrameTiming::Breakdown* latency,
+                    float depthRangeMin, float depthRangeMax);
+
+        // 창에서 마지막으로 눌린 키 (없으면 0, 읽으면 지워짐)
+        char takeKey();
+
+    private:
+        // 처리 루프 → 표시 스레드 전달 슬롯 (교대로 사용하며 버퍼 재사용)
+        struct Slot {
+            size_t viewCount = 0;
+            std::vector<cv::Mat> colors;
+            std::vector<cv::Mat> depths;
+            std::vector<PoseResult> poses;
+            std::vector<float> centerDists;
+            FPSCounter::Stats stats;
+            FrameTiming::Breakdown latency;
+            bool hasLatency = false;
+            float depthRangeMin = 0.0f;
+            float depthRangeMax = 0.0f;
+        };
+
+        // 미리 그려 둔 문구 (검은 배경 위 글자 + 픽셀별 불투명도)
+        struct Label {
+            std::vector<long long> keys; // 표시 정밀도로 양자화한 마지막 값 (동적 문구)
+            cv::Mat image;
+            cv::Mat alpha;
+        };
+
+        void run();
+        void render(Slot& slot);
+
+        // 값이 표시 정밀도에서 바뀌었는지 확인하고 keys 갱신
+        static bool changed(Label& label, std::initializer_list<double> values, double precision);
+
+        // 문구를 이미지로 렌더링 (backgroundAlpha > 0이면 반투명 배경 상자 포함)
+        static void renderLabel(Label& label, const std::string& text, double scale, const cv::Scalar& color, int backgroundAlpha);
+
+        // 대상 이미지의 origin(왼쪽 위) 위치에 문구를 알파 블렌딩 (이미지 밖은 잘라냄)
+        static void blendLabel(cv::Mat& target, const Label& label, cv::Point origin);
+
+        const AppConfig& config;
+        int64_t frameIntervalUs; // 0이면 상한 없음
+
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable condition;
+        Slot pending;
+        Slot working;
+        std::atomic<bool> hasPending;
+        std::atomic<int64_t> nextFrameUs;
+        std::atomic<int> lastKey;
+        bool stopping;
+        bool running;
+
+        // 표시 스레드 전용 문구/합성 버퍼
+        Label controlsLabel;
+        Label depthRangeLabel;
+        Label fpsLabel;
+        Label tailLabel;
+        Label latencyLabel;
+        std::vector<Label> distanceLabels;
+        std::vector<cv::Mat> poseViews;
+        std::vector<cv::Mat> depthViews;
+        cv::Mat poseMosaic;
+        cv::Mat depthMosaic;
+        cv::Mat composite;
+    };
+}
@@ -0,0 +1,195 @@
+#include "EngineBindings.h"
+#include <iostream>
+#ifdef WITH_TENSORRT
+#include <cuda_runtime_api.h>
+#endif
+
+namespace Utils {
+    int selectHeatmapOutput(const std::vector<OutputShape>& outputs, int numKeypoints, int heatmapH, int heatmapW) {
+        int sizeMatch = -1;
+        int withTags = -1;
+        int first = -1;
+        for (size_t i = 0; i < outputs.size(); i++) {
+            const OutputShape& shape = outputs[i];
+            if (shape.channels < numKeypoints) continue;
+            int index = static_cast<int>(i);
+            if (first < 0) first = index;
+            if (withTags < 0 && shape.channels == 2 * numKeypoints) withTags = index;
+            if (sizeMatch < 0 && shape.height == heatmapH && shape.width == heatmapW) sizeMatch = index;
+        }
+        if (sizeMatch >= 0) return sizeMatch;
+        if (withTags >= 0) return withTags;
+        return first;
+    }
+
+#ifdef WITH_TENSORRT
+    namespace {
+        size_t elementSize(nvinfer1::DataType type) {
+            switch (type) {
+                case nvinfer1::DataType::kHALF: return 2;
+                case nvinfer1::DataType::kINT8: return 1;
+                case nvinfer1::DataType::kBOOL: return 1;
+                default: return 4; // kFLOAT, kINT32
+            }
+        }
+
+        // 원소 수 (미정 차원이 있으면 0)
+        size_t volume(const nvinfer1::Dims& dims) {
+            size_t size = 1;
+            for (int i = 0; i < dims.nbDims; i++) {
+                if (dims.d[i] < 0) return 0;
+                size *= dims.d[i];
+            }
+            return size;
+        }
+
+        // 이미지 한 장 기준 출력 형태 (NCHW가 아니면 채널 0)
+        OutputShape shapeOf(const nvinfer1::Dims& dims) {
+            if (dims.nbDims != 4) return OutputShape{0, 0, 0};
+            return OutputShape{dims.d[1], dims.d[2], dims.d[3]};
+        }
+    }
+
+    EngineBindings::EngineBindings() : inputIndex_(-1), heatmapIndex_(-1) {
+    }
+
+    EngineBindings::~EngineBindings() {
+        release();
+    }
+
+    bool EngineBindings::init(const nvinfer1::ICudaEngine& engine) {
+        release();
+        bindings_.clear();
+        inputIndex_ = -1;
+        heatmapIndex_ = -1;
+
+        int numBindings = engine.getNbBindings();
+        for (int i = 0; i < numBindings; i++) {
+            Binding binding;
+            binding.name = engine.getBindingName(i);
+            binding.isInput = engine.bindingIsInput(i);
+            binding.type = engine.getBindingDataType(i);
+            binding.dims = engine.getBindingDimensions(i);
+            binding.maxDims = binding.dims;
+            binding.bytes = 0;
+            bindings_.push_back(binding);
+
+            if (!binding.isInput) continue;
+            if (inputIndex_ >= 0) {
+                std::cerr << "입력 바인딩이 둘 이상인 엔진은 지원하지 않습니다: " << bindings_[inputIndex_].name
+                          << ", " << binding.name << std::endl;
+                return false;
+            }
+            inputIndex_ = i;
+        }
+
+        if (inputIndex_ < 0) {
+            std::cerr << "엔진에 입력 바인딩이 없습니다." << std::endl;
+            return false;
+        }
+        const Binding& input = bindings_[inputIndex_];
+        if (input.type != nvinfer1::DataType::kFLOAT || input.dims.nbDims != 4 || input.dims.d[1] != 3) {
+            std::cerr << "입력 바인딩은 float NCHW 3채널이어야 합니다: " << input.name << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool EngineBindings::allocate(const nvinfer1::IExecutionContext& context) {
+        release();
+        device_.assign(bindings_.size(), nullptr);
+        for (size_t i = 0; i < bindings_.size(); i++) {
+            Binding& binding = bindings_[i];
+            binding.maxDims = context.getBindingDimensions(static_cast<int>(i));
+            binding.dims = binding.maxDims;
+            size_t elements = volume(binding.maxDims);
+            if (elements == 0) {
+                std::cerr << "바인딩 크기를 결정할 수 없습니다: " << binding.name << std::endl;
+                release();
+                return false;
+            }
+            binding.bytes = elements * elementSize(binding.type);
+            if (cudaMalloc(&device_[i], binding.bytes) != cudaSuccess) {
+                std::cerr << "디바이스 메모리 할당 실패: " << binding.name << " (" << binding.bytes << "바이트)" << std::endl;
+                device_[i] = nullptr;
+                release();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool EngineBindings::selectHeatmaps(int numKeypoints, int heatmapH, int heatmapW) {
+        // 출력 바인딩만 후보로 (float 이외 형식은 호스트 디코더가 읽을 수 없으므로 제외)
+        std::vector<OutputShape> shapes;
+        std::vector<int> indices;
+        for (size_t i = 0; i < bindings_.size(); i++) {
+            const Binding& binding = bindings_[i];
+            if (binding.isInput || binding.type != nvinfer1::DataType::kFLOAT) continue;
+            shapes.push_back(shapeOf(binding.dims));
+            indices.push_back(static_cast<int>(i));
+        }
+
+        int selected = selectHeatmapOutput(shapes, numKeypoints, heatmapH, heatmapW);
+        if (selected < 0) {
+            std::cerr << "히트맵 출력을 찾을 수 없습니다 (" << numKeypoints << "채널 이상의 float NCHW 출력 필요)" << std::endl;
+            return false;
+        }
+        heatmapIndex_ = indices[selected];
+
+        const Binding& heatmaps = bindings_[heatmapIndex_];
+        std::cout << "히트맵 출력: " << heatmaps.name << " (" << heatmaps.dims.d[1] << "채널 중 " << numKeypoints
+                  << "채널 사용, " << heatmaps.dims.d[3] << "x" << heatmaps.dims.d[2] << ")" << std::endl;
+        return true;
+    }
+
+    void EngineBindings::refresh(const nvinfer1::IExecutionContext& context) {
+        for (size_t i = 0; i < bindings_.size(); i++) {
+            bindings_[i].dims = context.getBindingDimensions(static_cast<int>(i));
+        }
+    }
+
+    void EngineBindings::release() {
+        for (void*& buffer : device_) {
+            if (buffer) {
+                cudaFree(buffer);
+                buffer = nullptr;
+            }
+        }
+    }
+
+    void** EngineBindings::data() {
+        return device_.data();
+    }
+
+    int EngineBindings::inputIndex() const {
+        return inputIndex_;
+    }
+
+    int EngineBindings::heatmapIndex() const {
+        return heatmapIndex_;
+    }
+
+    const EngineBindings::Binding& EngineBindings::binding(int index) const {
+        return bindings_[index];
+    }
+
+    bool EngineBindings::copyInput(const float* host, size_t elements) {
+        return cudaMemcpy(device_[inputIndex_], host, elements * sizeof(float), cudaMemcpyHostToDevice) == cudaSuccess;
+    }
+
+    bool EngineBindings::copyHeatmaps(float* host, int count, int numKeypoints) {
+        const nvinfer1::Dims& dims = bindings_[heatmapIndex_].dims;
+        size_t planeBytes = static_cast<size_t>(dims.d[2]) * dims.d[3] * sizeof(float);
+        size_t usedBytes = numKeypoints * planeBytes;  // 이미지별로 복사할 앞쪽 채널
+        size_t imageBytes = dims.d[1] * planeBytes;    // 디바이스 출력의 이미지 간격
+
+        // 이미지 한 장이거나 사용하지 않는 채널이 없으면 연속 복사, 아니면 이미지별 앞 채널만 2D 복사
+        if (count == 1 || usedBytes == imageBytes) {
+            return cudaMemcpy(host, device_[heatmapIndex_], count * usedBytes, cudaMemcpyDeviceToHost) == cudaSuccess;
+        }
+        return cudaMemcpy2D(host, usedBytes, device_[heatmapIndex_], imageBytes, usedBytes, count,
+                            cudaMemcpyDeviceToHost) == cudaSuccess;
+    }
+#endif
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#ifdef WITH_TENSORRT
+#include <NvInfer.h>
+#endif
+
+namespace Utils {
+    // 모델 출력 텐서 하나의 형태 (이미지 한 장 기준 NCHW의 C, H, W)
+    struct OutputShape {
+        int channels;
+        int height;
+        int width;
+    };
+
+    // 출력 중 포즈 디코더가 읽을 히트맵 출력 선택 - 이름이 아닌 형태로 판별 (백엔드 공용)
+    // - 후보: 채널 수가 numKeypoints 이상인 출력 (앞 numKeypoints 채널이 히트맵, 나머지는 연관 임베딩 태그 등)
+    // - 우선순위: 설정 히트맵 크기와 같은 출력 → 히트맵+태그(2 x numKeypoints 채널) 출력 → 첫 번째 후보
+    // - 후보가 없으면 -1
+    int selectHeatmapOutput(const std::vector<OutputShape>& outputs, int numKeypoints, int heatmapH, int heatmapW);
+
+#ifdef WITH_TENSORRT
+    // TensorRT 엔진 바인딩 관리 - 바인딩 수/이름에 의존하지 않고 모든 입출력을 열거해 버퍼 할당
+    // - 디바이스 버퍼는 바인딩 데이터 형식과 최대 차원(동적 엔진은 최적화 프로파일 최대) 기준 크기
+    // - 히트맵 출력은 selectHeatmapOutput 규칙으로 선택, 호스트로는 이미지별 앞 numKeypoints 채널만 복사
+    class EngineBindings {
+    public:
+        struct Binding {
+            std::string name;
+            bool isInput;
+            nvinfer1::DataType type;
+            nvinfer1::Dims dims;    // 현재 컨텍스트 차원
+            nvinfer1::Dims maxDims; // 디바이스 버퍼 할당 기준 차원
+            size_t bytes;
+        };
+
+        EngineBindings();
+        ~EngineBindings();
+        EngineBindings(const EngineBindings&) = delete;
+        EngineBindings& operator=(const EngineBindings&) = delete;
+
+        // 바인딩 열거 및 입력 확인 (float NCHW 3채널 입력 하나만 지원)
+        bool init(const nvinfer1::ICudaEngine& engine);
+
+        // 모든 바인딩의 디바이스 버퍼 할당 - 컨텍스트 입력 차원이 최대 크기로 설정된 상태에서 호출
+        bool allocate(const nvinfer1::IExecutionContext& context);
+
+        // 현재 컨텍스트 차원으로 히트맵 출력 선택 (float 출력만)
+        bool selectHeatmaps(int numKeypoints, int heatmapH, int heatmapW);
+
+        // 입력 크기 변경 후 현재 차원 갱신
+        void refresh(const nvinfer1::IExecutionContext& context);
+
+        // 디바이스 버퍼 해제
+        void release();
+
+        // executeV2에 넘길 바인딩 포인터 배열
+        void** data();
+
+        int inputIndex() const;
+        int heatmapIndex() const;
+        const Binding& binding(int index) const;
+
+        // 입력 버퍼로 복사 (elements개 float)
+        bool copyInput(const float* host, size_t elements);
+
+        // 히트맵 출력에서 이미지별 앞 numKeypoints 채널만 호스트로 복사 - host에는 이미지별로 연속 배치
+        bool copyHeatmaps(float* host, int count, int numKeypoints);
+
+    private:
+        std::vector<Binding> bindings_;
+        std::vector<void*> device_;
+        int inputIndex_;
+        int heatmapIndex_;
+    };
+#endif
+}
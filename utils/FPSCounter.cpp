@@ -1,7 +1,7 @@
 #include "FPSCounter.h"
 
 namespace Utils {
-    FPSCounter::FPSCounter() {
+    FPSCounter::FPSCounter(int windowSize) : frameTimes(windowSize) {
         lastTime = std::chrono::high_resolution_clock::now();
     }
 
@@ -10,22 +10,22 @@ namespace Utils {
         float delta = std::chrono::duration<float>(currentTime - lastTime).count();
         lastTime = currentTime;
         
-        // 프레임 시간 기록
-        frameTimes.push_back(delta);
-        
-        // 최대 샘플 수 유지
-        if (frameTimes.size() > maxSamples) {
-            frameTimes.pop_front();
-        }
-        
-        // 평균 프레임 시간 계산
-        float avgTime = 0.0f;
-        for (float t : frameTimes) {
-            avgTime += t;
-        }
-        avgTime /= frameTimes.size();
+        // 프레임 시간 기록 (링 버퍼 + 누적 합)
+        frameTimes.add(delta);
         
         // FPS 계산 및 반환
-        return 1.0f / avgTime;
+        float avgTime = frameTimes.mean();
+        return avgTime > 0.0f ? 1.0f / avgTime : 0.0f;
+    }
+
+    FPSCounter::Stats FPSCounter::getStats() const {
+        Stats stats;
+        float avgTime = frameTimes.mean();
+        stats.fps = avgTime > 0.0f ? 1.0f / avgTime : 0.0f;
+        stats.meanMs = avgTime * 1000.0f;
+        stats.p50Ms = frameTimes.percentile(0.5f) * 1000.0f;
+        stats.p99Ms = frameTimes.percentile(0.99f) * 1000.0f;
+        stats.maxMs = frameTimes.max() * 1000.0f;
+        return stats;
     }
-} 
\ No newline at end of file
+}
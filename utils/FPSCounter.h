@@ -1,18 +1,32 @@
 #pragma once
 
 #include <chrono>
-#include <deque>
+#include "WindowedStats.h"
 
 namespace Utils {
     // FPS 측정을 위한 클래스
+    // 프레임 간격을 고정 크기 윈도우(WindowedStats)에 기록하여 평균 FPS와 꼬리 지연을 함께 제공
     class FPSCounter {
-    private:
-        std::chrono::time_point<std::chrono::high_resolution_clock> lastTime;
-        std::deque<float> frameTimes;
-        const int maxSamples = 30; // 이동 평균을 위한 샘플 수
-        
     public:
-        FPSCounter();
+        // 윈도우 통계 (프레임 시간은 밀리초)
+        struct Stats {
+            float fps;      // 평균 프레임 시간 기준 FPS
+            float meanMs;
+            float p50Ms;
+            float p99Ms;
+            float maxMs;    // 윈도우 내 최대 정지 시간
+        };
+
+        FPSCounter(int windowSize = 30);
+
+        // 프레임마다 호출 - 평균 FPS 반환 (O(1))
         float update();
+
+        // 현재 윈도우 통계
+        Stats getStats() const;
+
+    private:
+        std::chrono::time_point<std::chrono::high_resolution_clock> lastTime;
+        WindowedStats frameTimes;
     };
-} 
\ No newline at end of file
+}
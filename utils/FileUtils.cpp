@@ -22,20 +22,26 @@ namespace Utils {
             #endif
         }
 
-        int findNextResultFolder(const std::string& baseDir) {
-            int folderNum = 1;
-            
-            while (true) {
-                std::stringstream ss;
-                ss << baseDir << "result" << folderNum;
-                std::string folderPath = ss.str();
-                
-                if (!directoryExists(folderPath)) {
-                    return folderNum;
-                }
-                
-                folderNum++;
+        long long fileSize(const std::string& path) {
+            struct stat info;
+            if (stat(path.c_str(), &info) != 0) {
+                return -1;
             }
+            return static_cast<long long>(info.st_size);
+        }
+
+        std::string currentTimestamp() {
+            std::time_t now = std::time(nullptr);
+            std::tm local;
+            #ifdef _WIN32
+                localtime_s(&local, &now);
+            #else
+                localtime_r(&now, &local);
+            #endif
+            
+            char buffer[32];
+            std::strftime(buffer, sizeof(buffer), "%Y%m%d_%H%M%S", &local);
+            return buffer;
         }
 
     } 
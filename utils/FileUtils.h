@@ -12,7 +12,10 @@ namespace Utils {
         // 디렉토리 생성 함수
         bool createDirectory(const std::string& dir);
         
-        // 다음 사용 가능한 result 폴더 번호 찾기
-        int findNextResultFolder(const std::string& baseDir);
+        // 파일 크기 (바이트, 없으면 -1)
+        long long fileSize(const std::string& path);
+        
+        // 현재 로컬 시각 문자열 (YYYYMMDD_HHMMSS, 세션 디렉토리 이름용)
+        std::string currentTimestamp();
     } 
 } 
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "FramePool.h"
+#include <cstdlib>
+#include <new>
+
+namespace Utils {
+    namespace {
+        const size_t BUFFER_ALIGNMENT = 64; // 캐시 라인/SIMD 정렬
+
+        // cv::AccessFlag는 OpenCV 4.2부터 (4.0/4.1, 예: JetPack 4.1.1은 int)
+#if CV_VERSION_MAJOR > 4 || (CV_VERSION_MAJOR == 4 && CV_VERSION_MINOR >= 2)
+        typedef cv::AccessFlag AccessFlags;
+#else
+        typedef int AccessFlags;
+#endif
+    }
+
+    // cv::Mat 버퍼 할당/해제를 풀로 연결 (cv::StdMatAllocator와 같은 규칙, 버퍼 출처만 다름)
+    class FramePool::Allocator : public cv::MatAllocator {
+    public:
+        explicit Allocator(FramePool& pool) : pool(pool) {}
+
+        cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step,
+                               AccessFlags, cv::UMatUsageFlags) const override {
+            size_t total = CV_ELEM_SIZE(type);
+            for (int i = dims - 1; i >= 0; i--) {
+                if (step) {
+                    if (data && step[i] != CV_AUTOSTEP) {
+                        total = step[i];
+                    } else {
+                        step[i] = total;
+                    }
+                }
+                total *= sizes[i];
+            }
+
+            cv::UMatData* u = new cv::UMatData(this);
+            u->data = u->origdata = data ? static_cast<uchar*>(data) : static_cast<uchar*>(pool.take(total));
+            u->size = total;
+            if (data) {
+                u->flags |= cv::UMatData::USER_ALLOCATED;
+            }
+            return u;
+        }
+
+        bool allocate(cv::UMatData* u, AccessFlags, cv::UMatUsageFlags) const override {
+            return u != nullptr;
+        }
+
+        void deallocate(cv::UMatData* u) const override {
+            if (!u) return;
+            if (!(u->flags & cv::UMatData::USER_ALLOCATED)) {
+                pool.give(u->origdata, u->size);
+                u->origdata = nullptr;
+            }
+            delete u;
+        }
+
+    private:
+        FramePool& pool;
+    };
+
+    FramePool& FramePool::instance() {
+        static FramePool* pool = new FramePool();
+        return *pool;
+    }
+
+    FramePool::FramePool(size_t maxIdlePerSize)
+        : maxIdlePerSize(maxIdlePerSize), matAllocator(new Allocator(*this)), stats{0, 0, 0, 0, 0} {
+    }
+
+    FramePool::~FramePool() {
+        // 사용 중인 버퍼는 마지막 cv::Mat이 놓을 때 반환되므로 풀이 먼저 소멸하면 안 됨 (instance()는 소멸하지 않음)
+        for (auto& entry : idleBuffers) {
+            for (void* buffer : entry.second) {
+                free(buffer);
+            }
+        }
+    }
+
+    cv::Mat FramePool::acquire(int rows, int cols, int type) {
+        cv::Mat mat = attach();
+        mat.create(rows, cols, type);
+        return mat;
+    }
+
+    cv::Mat FramePool::attach() {
+        cv::Mat mat;
+        mat.allocator = matAllocator.get();
+        return mat;
+    }
+
+    cv::MatAllocator* FramePool::allocator() {
+        return matAllocator.get();
+    }
+
+    FramePool::Stats FramePool::getStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    void* FramePool::take(size_t size) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = idleBuffers.find(size);
+            if (it != idleBuffers.end() && !it->second.empty()) {
+                void* buffer = it->second.back();
+                it->second.pop_back();
+                stats.hits++;
+                stats.idle--;
+                stats.inUse++;
+                return buffer;
+            }
+            stats.misses++;
+        }
+
+        // 새 버퍼 할당은 잠금 밖에서 (다른 단계의 반환을 막지 않음)
+        void* buffer = nullptr;
+        if (posix_memalign(&buffer, BUFFER_ALIGNMENT, size > 0 ? size : BUFFER_ALIGNMENT) != 0) {
+            throw std::bad_alloc();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.inUse++;
+        stats.bytes += size;
+        return buffer;
+    }
+
+    void FramePool::give(void* buffer, size_t size) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stats.inUse--;
+            std::vector<void*>& idle = idleBuffers[size];
+            if (idle.size() < maxIdlePerSize) {
+                idle.push_back(buffer);
+                stats.idle++;
+                return;
+            }
+            stats.bytes -= size;
+        }
+        free(buffer);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <opencv2/core.hpp>
+
+namespace Utils {
+    // 파이프라인 단계 공용 이미지 버퍼 풀 - 프레임마다 해제/할당하던 cv::Mat 버퍼를 재사용
+    // - cv::MatAllocator로 동작: 풀 할당자를 붙인 cv::Mat은 평소처럼 복사/전달하고, cv::Mat 참조 카운트가
+    //   0이 되면 (마지막 단계가 놓으면) 버퍼가 해제되지 않고 풀로 돌아감
+    // - 버퍼는 크기(바이트, 즉 크기와 형식)별로 보관하고 64바이트 정렬
+    // - 크기별 유휴 버퍼는 maxIdlePerSize개까지만 보관 (해상도가 바뀌어도 사용하지 않는 크기가 쌓이지 않음)
+    class FramePool {
+    public:
+        struct Stats {
+            uint64_t hits;   // 유휴 버퍼를 재사용한 할당 수
+            uint64_t misses; // 새로 할당한 수
+            size_t inUse;    // 사용 중인 버퍼 수
+            size_t idle;     // 풀에 보관 중인 버퍼 수
+            size_t bytes;    // 사용 중 + 보관 중 버퍼 총 크기
+        };
+
+        // 프로세스 공용 풀 (종료 시에도 해제하지 않음 - 정적 객체가 잡고 있던 cv::Mat도 안전하게 반환)
+        static FramePool& instance();
+
+        explicit FramePool(size_t maxIdlePerSize = 8);
+        ~FramePool();
+        FramePool(const FramePool&) = delete;
+        FramePool& operator=(const FramePool&) = delete;
+
+        // 풀 버퍼의 rows x cols 이미지 (내용은 초기화되지 않음)
+        cv::Mat acquire(int rows, int cols, int type);
+
+        // 빈 cv::Mat에 풀 할당자를 붙임 - 이후 출력 인자로 넘기면 OpenCV 함수가 풀 버퍼에 결과를 씀
+        cv::Mat attach();
+
+        // 풀 할당자 (cv::Mat::allocator에 직접 지정할 때)
+        cv::MatAllocator* allocator();
+
+        Stats getStats() const;
+
+    private:
+        class Allocator;
+
+        void* take(size_t size);
+        void give(void* buffer, size_t size);
+
+        size_t maxIdlePerSize;
+        std::unique_ptr<Allocator> matAllocator;
+        mutable std::mutex mutex;
+        std::map<size_t, std::vector<void*>> idleBuffers;
+        Stats stats;
+    };
+}
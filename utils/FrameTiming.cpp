@@ -0,0 +1,61 @@
+#include "FrameTiming.h"
+#include <chrono>
+
+namespace Utils {
+    FrameTiming::FrameTiming()
+        : frameNumber(0), sensorMs(-1.0), arrivalMs(-1.0), acquiredMs(-1.0),
+          depthDoneMs(-1.0), poseDoneMs(-1.0), renderDoneMs(-1.0) {
+    }
+
+    double FrameTiming::nowMs() {
+        return std::chrono::duration<double, std::milli>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    void FrameTiming::begin(uint64_t frameNumber, const rs2::frame& frame) {
+        this->frameNumber = frameNumber;
+        acquiredMs = nowMs();
+
+        // 전역 시간 도메인이면 센서 타임스탬프가 호스트 시계로 변환되어 있음
+        rs2_timestamp_domain domain = frame.get_frame_timestamp_domain();
+        sensorMs = (domain == RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME || domain == RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME)
+            ? frame.get_timestamp() : -1.0;
+
+        arrivalMs = frame.supports_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL)
+            ? static_cast<double>(frame.get_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL)) : -1.0;
+
+        depthDoneMs = -1.0;
+        poseDoneMs = -1.0;
+        renderDoneMs = -1.0;
+    }
+
+    void FrameTiming::markDepthDone() {
+        depthDoneMs = nowMs();
+    }
+
+    void FrameTiming::markPoseDone() {
+        poseDoneMs = nowMs();
+    }
+
+    void FrameTiming::markRenderDone() {
+        renderDoneMs = nowMs();
+    }
+
+    namespace {
+        // 두 시각이 모두 유효할 때만 차이 계산
+        double span(double from, double to) {
+            return (from >= 0.0 && to >= 0.0) ? to - from : -1.0;
+        }
+    }
+
+    FrameTiming::Breakdown FrameTiming::breakdown() const {
+        Breakdown result;
+        result.sensorToArrivalMs = span(sensorMs, arrivalMs);
+        result.arrivalToAcquireMs = span(arrivalMs, acquiredMs);
+        result.depthMs = span(acquiredMs, depthDoneMs);
+        result.poseMs = span(depthDoneMs, poseDoneMs);
+        result.renderMs = span(poseDoneMs, renderDoneMs);
+        result.endToEndMs = span(sensorMs >= 0.0 ? sensorMs : arrivalMs, renderDoneMs);
+        return result;
+    }
+}
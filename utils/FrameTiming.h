@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <librealsense2/rs.hpp>
+
+namespace Utils {
+    // 프레임별 지연 측정용 타임스탬프 (모두 system_clock 기준 밀리초, 측정 불가 항목은 음수)
+    // 프레임셋과 함께 파이프라인 단계를 따라가며 각 단계 종료 시각을 기록
+    struct FrameTiming {
+        uint64_t frameNumber;
+        double sensorMs;     // 센서 타임스탬프 (전역/시스템 시간 도메인일 때만 유효)
+        double arrivalMs;    // 호스트 도착 시각 (TIME_OF_ARRIVAL 메타데이터)
+        double acquiredMs;   // 메인 루프가 프레임셋을 받은 시각
+        double depthDoneMs;  // 깊이 시각화/거리 계산 완료
+        double poseDoneMs;   // 포즈 추정 완료
+        double renderDoneMs; // 렌더링(헤드리스는 결과 발행) 완료
+
+        // 구간별 지연 (밀리초)
+        struct Breakdown {
+            double sensorToArrivalMs;  // 센서 → 호스트 도착 (USB 전송/센서 버퍼링)
+            double arrivalToAcquireMs; // 호스트 도착 → 메인 루프 수신 (librealsense 큐 대기)
+            double depthMs;
+            double poseMs;
+            double renderMs;
+            double endToEndMs;         // 센서(없으면 호스트 도착) → 렌더 완료
+        };
+
+        FrameTiming();
+
+        static double nowMs();
+
+        // 프레임 수신 직후 호출 - 메타데이터 타임스탬프와 수신 시각 기록
+        void begin(uint64_t frameNumber, const rs2::frame& frame);
+
+        void markDepthDone();
+        void markPoseDone();
+        void markRenderDone();
+
+        Breakdown breakdown() const;
+    };
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include "CpuFeatures.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+// 고정 크기 호출에서 크기 상수가 스캔 루프까지 전파되도록 강제 인라인
+#if defined(__GNUC__)
+#define HEATMAP_ARGMAX_INLINE inline __attribute__((always_inline))
+#else
+#define HEATMAP_ARGMAX_INLINE inline
+#endif
+
+namespace Utils {
+    namespace HeatmapArgmax {
+
+        // 채널 하나의 최대값과 위치 (행 우선 인덱스, 동률이면 가장 앞선 위치 - cv::minMaxLoc과 동일)
+        struct Peak {
+            float value;
+            int index;
+        };
+
+        namespace detail {
+            // 스칼라 경로 (SIMD 미지원 환경 및 나머지 원소 처리)
+            inline void scanScalar(const float* data, int begin, int end, Peak& peak) {
+                for (int i = begin; i < end; i++) {
+                    if (data[i] > peak.value) {
+                        peak.value = data[i];
+                        peak.index = i;
+                    }
+                }
+            }
+
+            // 레인별 최대값/인덱스를 하나로 축약 - 값이 같으면 작은 인덱스 우선
+            inline void reduceLanes(const float* values, const int* indices, int lanes, Peak& peak) {
+                for (int l = 0; l < lanes; l++) {
+                    if (values[l] > peak.value || (values[l] == peak.value && indices[l] < peak.index)) {
+                        peak.value = values[l];
+                        peak.index = indices[l];
+                    }
+                }
+            }
+
+            // SIMD 미지원 x86 경로 또는 NEON 경로 (aarch64는 NEON이 항상 있음)
+            HEATMAP_ARGMAX_INLINE Peak scan(const float* data, int size) {
+                Peak peak = {data[0], 0};
+                int i = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+                // 4레인 비교 후 더 큰 값만 갱신 (Jetson 등 aarch64)
+                if (size >= 4) {
+                    float32x4_t maxValues = vld1q_f32(data);
+                    static const int initial[4] = {0, 1, 2, 3};
+                    int32x4_t maxIndices = vld1q_s32(initial);
+                    int32x4_t indices = maxIndices;
+                    const int32x4_t step = vdupq_n_s32(4);
+                    for (i = 4; i + 4 <= size; i += 4) {
+                        indices = vaddq_s32(indices, step);
+                        float32x4_t values = vld1q_f32(data + i);
+                        uint32x4_t greater = vcgtq_f32(values, maxValues);
+                        maxValues = vbslq_f32(greater, values, maxValues);
+                        maxIndices = vbslq_s32(greater, indices, maxIndices);
+                    }
+                    float laneValues[4];
+                    int laneIndices[4];
+                    vst1q_f32(laneValues, maxValues);
+                    vst1q_s32(laneIndices, maxIndices);
+                    reduceLanes(laneValues, laneIndices, 4, peak);
+                }
+#endif
+                scanScalar(data, i, size, peak);
+                return peak;
+            }
+
+#if defined(UTILS_HAVE_AVX2_KERNELS)
+            // AVX2 경로 - AVX2 target 함수 안에서만 호출 (CpuFeatures::hasAvx2()로 선택)
+            UTILS_AVX2_TARGET HEATMAP_ARGMAX_INLINE Peak scanAvx2(const float* data, int size) {
+                Peak peak = {data[0], 0};
+                int i = 0;
+                // 8레인 비교 후 더 큰 값만 갱신 (같은 레인 안에서는 먼저 나온 위치 유지)
+                if (size >= 8) {
+                    __m256 maxValues = _mm256_loadu_ps(data);
+                    __m256i maxIndices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+                    __m256i indices = maxIndices;
+                    const __m256i step = _mm256_set1_epi32(8);
+                    for (i = 8; i + 8 <= size; i += 8) {
+                        indices = _mm256_add_epi32(indices, step);
+                        __m256 values = _mm256_loadu_ps(data + i);
+                        __m256 greater = _mm256_cmp_ps(values, maxValues, _CMP_GT_OQ);
+                        maxValues = _mm256_blendv_ps(maxValues, values, greater);
+                        maxIndices = _mm256_castps_si256(_mm256_blendv_ps(
+                            _mm256_castsi256_ps(maxIndices), _mm256_castsi256_ps(indices), greater));
+                    }
+                    alignas(32) float laneValues[8];
+                    alignas(32) int laneIndices[8];
+                    _mm256_store_ps(laneValues, maxValues);
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(laneIndices), maxIndices);
+                    reduceLanes(laneValues, laneIndices, 8, peak);
+                }
+                scanScalar(data, i, size, peak);
+                return peak;
+            }
+
+            // Size > 0이면 컴파일 타임 크기 (루프 경계 상수), 0이면 size 사용
+            template <int Size>
+            UTILS_AVX2_TARGET void scanChannelsAvx2(const float* heatmaps, int channels, int size, Peak* peaks) {
+                const int n = Size > 0 ? Size : size;
+                for (int c = 0; c < channels; c++) {
+                    peaks[c] = scanAvx2(heatmaps + static_cast<size_t>(c) * n, n);
+                }
+            }
+#endif
+
+            // 채널별 최대값 - AVX2 지원 CPU면 AVX2 커널, 아니면 NEON/스칼라 커널
+            template <int Size>
+            HEATMAP_ARGMAX_INLINE void scanChannels(const float* heatmaps, int channels, int size, Peak* peaks) {
+#if defined(UTILS_HAVE_AVX2_KERNELS)
+                if (CpuFeatures::hasAvx2()) {
+                    scanChannelsAvx2<Size>(heatmaps, channels, size, peaks);
+                    return;
+                }
+#endif
+                const int n = Size > 0 ? Size : size;
+                for (int c = 0; c < channels; c++) {
+                    peaks[c] = scan(heatmaps + static_cast<size_t>(c) * n, n);
+                }
+            }
+        }
+
+        // 크기가 컴파일 타임에 고정된 히트맵 (128x128 등) - 루프 경계가 상수라 완전히 전개됨
+        template <int Height, int Width>
+        void findPeaks(const float* heatmaps, int channels, Peak* peaks) {
+            static_assert(Height > 0 && Width > 0, "Heatmap size must be positive");
+            detail::scanChannels<Height * Width>(heatmaps, channels, Height * Width, peaks);
+        }
+
+        // 임의 크기 히트맵 - 자주 쓰는 크기는 고정 크기 구현으로 분기
+        inline void findPeaks(const float* heatmaps, int channels, int height, int width, Peak* peaks) {
+            if (height == 128 && width == 128) {
+                findPeaks<128, 128>(heatmaps, channels, peaks);
+            } else if (height == 64 && width == 64) {
+                findPeaks<64, 64>(heatmaps, channels, peaks);
+            } else if (height == 256 && width == 256) {
+                findPeaks<256, 256>(heatmaps, channels, peaks);
+            } else {
+                detail::scanChannels<0>(heatmaps, channels, height * width, peaks);
+            }
+        }
+
+    } // namespace HeatmapArgmax
+} // namespace Utils
@@ -1,11 +1,15 @@
 #include "ImageSaver.h"
 #include <iostream>
 #include <sstream>
+#include <iomanip>
+#include <cstdlib>
+#include <algorithm>
+#include "CaptureIndex.h"
 
 namespace Utils {
-    ImageSaver::ImageSaver(const std::string& baseDirectory) : baseDirectory(baseDirectory) {
-        // 시작 폴더 번호 찾기
-        folderNumber = FileUtils::findNextResultFolder(baseDirectory);
+    ImageSaver::ImageSaver(const std::string& baseDirectory, const std::string& sessionName, int shardSize)
+        : baseDirectory(baseDirectory), sessionName(sessionName), shardSize(shardSize > 0 ? shardSize : 1000),
+          captureNumber(0), preparedShard(-1) {
     }
 
     bool ImageSaver::prepareFolder() {
@@ -14,41 +18,118 @@ namespace Utils {
             std::cerr << "결과 디렉토리 생성 실패: " << baseDirectory << std::endl;
             return false;
         }
-        
+
+        bool resume = !sessionName.empty();
+        if (resume) {
+            sessionDirectory = baseDirectory + sessionName + "/";
+        } else {
+            // 같은 초에 시작한 실행이 있을 때만 접미사를 붙임
+            std::string name = "session_" + FileUtils::currentTimestamp();
+            sessionDirectory = baseDirectory + name + "/";
+            for (int suffix = 2; FileUtils::directoryExists(sessionDirectory); suffix++) {
+                sessionDirectory = baseDirectory + name + "_" + std::to_string(suffix) + "/";
+            }
+        }
+
+        if (!FileUtils::createDirectory(sessionDirectory)) {
+            std::cerr << "세션 디렉토리 생성 실패: " << sessionDirectory << std::endl;
+            return false;
+        }
+
+        std::string indexPath = sessionDirectory + "index.csv";
+        bool partialLine = false;
+        captureNumber = resume ? readNextCaptureNumber(indexPath, partialLine) : 0;
+
+        index.open(indexPath, std::ios::app);
+        if (!index) {
+            std::cerr << "색인 파일을 열 수 없습니다: " << indexPath << std::endl;
+            return false;
+        }
+        if (index.tellp() == 0) {
+            index << "capture,frame_number,timestamp_ms,prefix" << std::endl;
+        } else if (partialLine) {
+            index << std::endl; // 중단된 줄 뒤에 이어 붙지 않도록
+        }
+
+        if (resume) {
+            std::cout << "세션 이어서 저장: " << sessionDirectory << " (다음 캡처 " << captureNumber << ")" << std::endl;
+        }
         return true;
     }
 
+    int ImageSaver::readNextCaptureNumber(const std::string& indexPath, bool& partialLine) {
+        std::ifstream file(indexPath, std::ios::binary);
+        if (!file) {
+            return 0;
+        }
+
+        // 색인 전체에서 온전한 줄의 최대 캡처 번호 (헤더, 중단되어 잘린 줄은 건너뜀 - 파일 탐색은 하지 않음)
+        int next = 0;
+        std::string line;
+        partialLine = false;
+        while (std::getline(file, line)) {
+            partialLine = file.eof(); // 마지막 줄이 줄바꿈 없이 끝남
+            CaptureIndex::Entry entry;
+            if (CaptureIndex::parseIndexLine(line, entry)) {
+                next = std::max(next, entry.capture + 1);
+            }
+        }
+        return next;
+    }
+
     bool ImageSaver::saveImages(const cv::Mat& colorImage, const cv::Mat& depthColormap, const rs2::depth_frame& depthFrame) {
-        // 폴더 경로 생성
-        std::stringstream folderSs;
-        folderSs << baseDirectory << "result" << folderNumber << "/";
-        std::string resultFolder = folderSs.str();
-        
-        // 폴더 생성
-        if (!FileUtils::createDirectory(resultFolder)) {
-            std::cerr << "폴더 생성 실패: " << resultFolder << std::endl;
+        if (sessionDirectory.empty()) {
+            std::cerr << "세션 디렉토리가 준비되지 않았습니다." << std::endl;
             return false;
         }
-        
-        // 파일 경로 생성
-        std::string colorFilename = resultFolder + "color.png";
-        std::string depthColormapFilename = resultFolder + "depth_colormap.png";
-        std::string depthBinFilename = resultFolder + "depth.bin";
-        
+
+        // 샤드 디렉토리는 바뀔 때만 생성
+        int shard = captureNumber / shardSize;
+        std::stringstream shardSs;
+        shardSs << "shard_" << std::setw(4) << std::setfill('0') << shard << "/";
+        std::string shardFolder = shardSs.str();
+        if (shard != preparedShard) {
+            if (!FileUtils::createDirectory(sessionDirectory + shardFolder)) {
+                std::cerr << "폴더 생성 실패: " << sessionDirectory + shardFolder << std::endl;
+                return false;
+            }
+            preparedShard = shard;
+        }
+
+        // 파일 경로 생성 (세션 기준 상대 접두사)
+        std::stringstream prefixSs;
+        prefixSs << shardFolder << std::setw(6) << std::setfill('0') << captureNumber << "_";
+        std::string prefix = prefixSs.str();
+        std::string filePrefix = sessionDirectory + prefix;
+
         // 이미지 저장
-        cv::imwrite(colorFilename, colorImage);
-        cv::imwrite(depthColormapFilename, depthColormap);
-        DepthProcessor::saveDepthToBin(depthFrame, depthBinFilename);
-        
-        std::cout << "파일이 저장되었습니다. 폴더: result" << folderNumber << std::endl;
-        
-        // 폴더 번호 증가
-        folderNumber++;
-        
+        cv::imwrite(filePrefix + "color.png", colorImage);
+        cv::imwrite(filePrefix + "depth_colormap.png", depthColormap);
+        DepthProcessor::saveDepthToBin(depthFrame, filePrefix + "depth.bin");
+        DepthProcessor::saveDepthIntrinsics(depthFrame, filePrefix + "depth_intrinsics.yml");
+
+        // 파일을 모두 쓴 뒤 색인에 추가
+        index << captureNumber << "," << depthFrame.get_frame_number() << ","
+              << std::fixed << std::setprecision(3) << depthFrame.get_timestamp() << ","
+              << prefix << std::endl;
+
+        std::cout << "파일이 저장되었습니다: " << filePrefix << "*" << std::endl;
+        lastCapturePrefix = filePrefix;
+
+        captureNumber++;
+
         return true;
     }
 
-    int ImageSaver::getCurrentFolderNumber() const {
-        return folderNumber;
+    int ImageSaver::getNextCaptureNumber() const {
+        return captureNumber;
+    }
+
+    const std::string& ImageSaver::getLastCapturePrefix() const {
+        return lastCapturePrefix;
+    }
+
+    const std::string& ImageSaver::getSessionDirectory() const {
+        return sessionDirectory;
     }
-} 
\ No newline at end of file
+}
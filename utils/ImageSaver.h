@@ -1,27 +1,51 @@
 #pragma once
 
 #include <string>
+#include <fstream>
 #include <opencv2/opencv.hpp>
 #include <librealsense2/rs.hpp>
 #include "FileUtils.h"
 #include "../DepthProcessor.h"
 
 namespace Utils {
+    // 실행(세션) 단위 저장 레이아웃
+    //   <baseDirectory>/session_YYYYMMDD_HHMMSS/
+    //       index.csv                      캡처 목록 (추가 전용: capture,frame_number,timestamp_ms,prefix)
+    //       shard_0000/000000_color.png    shardSize개 캡처마다 하위 디렉토리 하나
+    //       shard_0000/000000_depth_colormap.png, 000000_depth.bin, 000000_depth_intrinsics.yml
+    // - 시작 시 기존 캡처를 탐색하지 않으므로 캡처가 많이 쌓여도 시작 시간이 일정
     class ImageSaver {
     public:
-        ImageSaver(const std::string& baseDirectory);
-        
-        // 이미지 저장 폴더 준비
+        // sessionName: 비어 있으면 새 세션 생성, 지정하면 그 세션의 색인을 읽어 이어서 저장
+        ImageSaver(const std::string& baseDirectory, const std::string& sessionName = "", int shardSize = 1000);
+
+        // 세션 디렉토리 준비 (새 세션 생성 또는 기존 세션 색인 읽기)
         bool prepareFolder();
-        
-        // 이미지 저장
+
+        // 이미지 저장 (캡처 하나 = 파일 4개 + 색인 한 줄)
         bool saveImages(const cv::Mat& colorImage, const cv::Mat& depthColormap, const rs2::depth_frame& depthFrame);
-        
-        // 현재 폴더 번호 반환
-        int getCurrentFolderNumber() const;
-        
+
+        // 다음 캡처 번호 반환
+        int getNextCaptureNumber() const;
+
+        // 마지막으로 저장한 캡처의 파일 경로 접두사 (예: .../shard_0000/000012_, 저장 전에는 빈 문자열)
+        const std::string& getLastCapturePrefix() const;
+
+        // 세션 디렉토리 경로 ('/'로 끝남)
+        const std::string& getSessionDirectory() const;
+
     private:
+        // 기존 세션 색인에서 온전한 줄의 최대 캡처 번호 다음 값 (색인이 없으면 0, 잘린 줄은 무시)
+        // - partialLine: 색인이 줄바꿈 없이 끝남 (기록 도중 중단)
+        int readNextCaptureNumber(const std::string& indexPath, bool& partialLine);
+
         std::string baseDirectory;
-        int folderNumber;
+        std::string sessionName;
+        std::string sessionDirectory;
+        std::string lastCapturePrefix;
+        int shardSize;
+        int captureNumber;
+        int preparedShard; // 이미 생성한 마지막 샤드 번호 (-1이면 없음)
+        std::ofstream index;
     };
-} 
\ No newline at end of file
+}
@@ -1,14 +1,61 @@
 #include "KeyboardHandler.h"
+#include <csignal>
+#include <poll.h>
+#include <unistd.h>
+#include <utility>
 
 namespace Utils {
-    KeyboardHandler::KeyboardHandler() : lastKey(0) {
+    namespace {
+        // SIGINT/SIGTERM 수신 여부 (헤드리스 모드 종료용)
+        volatile std::sig_atomic_t quitSignalReceived = 0;
+
+        void handleQuitSignal(int) {
+            quitSignalReceived = 1;
+        }
+    }
+
+    KeyboardHandler::KeyboardHandler(bool headless) : lastKey(0), headless(headless) {
+        if (headless) {
+            std::signal(SIGINT, handleQuitSignal);
+            std::signal(SIGTERM, handleQuitSignal);
+        }
     }
 
     char KeyboardHandler::waitKey(int delay) {
-        lastKey = cv::waitKey(delay);
+        if (keySource) {
+            lastKey = keySource();
+        } else if (headless) {
+            lastKey = pollStdin(delay);
+        } else {
+            lastKey = cv::waitKey(delay);
+        }
         return lastKey;
     }
 
+    void KeyboardHandler::setKeySource(std::function<char()> source) {
+        keySource = std::move(source);
+    }
+
+    char KeyboardHandler::pollStdin(int delay) {
+        if (quitSignalReceived) {
+            return 'q';
+        }
+
+        // 표준 입력이 준비된 경우에만 읽음 (터미널에서는 Enter 입력 후 전달됨)
+        pollfd fds;
+        fds.fd = STDIN_FILENO;
+        fds.events = POLLIN;
+        fds.revents = 0;
+        if (poll(&fds, 1, delay) > 0 && (fds.revents & POLLIN)) {
+            char key = 0;
+            if (read(STDIN_FILENO, &key, 1) == 1) {
+                return key;
+            }
+        }
+
+        return quitSignalReceived ? 'q' : 0;
+    }
+
     bool KeyboardHandler::isQuitPressed() const {
         return lastKey == 'q';
     }
@@ -20,4 +67,4 @@ namespace Utils {
     char KeyboardHandler::getLastKey() const {
         return lastKey;
     }
-} 
\ No newline at end of file
+}
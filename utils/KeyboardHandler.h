@@ -1,15 +1,20 @@
 #pragma once
 
 #include <opencv2/opencv.hpp>
+#include <functional>
 
 namespace Utils {
     class KeyboardHandler {
     public:
-        KeyboardHandler();
+        // headless가 true이면 HighGUI 대신 표준 입력과 종료 시그널로 키 입력 처리
+        KeyboardHandler(bool headless = false);
         
         // 키 입력 처리
         char waitKey(int delay = 1);
         
+        // 창 이벤트를 다른 스레드가 처리할 때 키를 가져올 함수 지정 (설정되면 waitKey는 대기 없이 이 함수 사용)
+        void setKeySource(std::function<char()> source);
+        
         // 종료 키가 눌렸는지 확인
         bool isQuitPressed() const;
         
@@ -21,5 +26,10 @@ namespace Utils {
         
     private:
         char lastKey;
+        bool headless;
+        std::function<char()> keySource;
+
+        // 표준 입력에서 키 읽기 (헤드리스 모드)
+        char pollStdin(int delay);
     };
-} 
\ No newline at end of file
+}
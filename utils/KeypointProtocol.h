@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Utils {
+    // 키포인트 전송용 바이너리 프로토콜 (리틀엔디언, 패딩 없음)
+    // 패킷 구성: 헤더 | 2D 키포인트 [사람 수 * 키포인트 수] | (3D 플래그 시) 3D 키포인트 [사람 수 * 키포인트 수]
+    namespace KeypointProtocol {
+        const uint32_t MAGIC = 0x4B535052; // "RPSK"
+        const uint16_t VERSION = 2;
+
+        // 헤더 플래그
+        const uint16_t FLAG_HAS_3D = 0x0001;
+
+        // 데이터그램 최대 크기 (Unix 도메인 소켓 기본 한도 이내)
+        const int MAX_PACKET_SIZE = 64 * 1024;
+
+#pragma pack(push, 1)
+        struct Header {
+            uint32_t magic;
+            uint16_t version;
+            uint16_t flags;
+            uint64_t frameNumber;   // 발행자 측 프레임 번호
+            int64_t timestampUs;    // 발행 시각 (system_clock, 마이크로초)
+            uint16_t numPersons;
+            uint16_t numKeypoints;
+            uint16_t cameraIndex;   // 다중 카메라 구성에서의 카메라 번호 (단일 카메라는 0)
+            uint16_t reserved;
+        };
+
+        // 이미지 좌표 (픽셀), 무효 키포인트는 (-1, -1)
+        struct Point2D {
+            int16_t x;
+            int16_t y;
+        };
+
+        // 깊이 카메라 좌표계 (미터), 깊이가 없으면 (0, 0, 0)
+        struct Point3D {
+            float x;
+            float y;
+            float z;
+        };
+#pragma pack(pop)
+
+        static_assert(sizeof(Header) == 32, "KeypointProtocol::Header 크기가 변경되었습니다");
+        static_assert(sizeof(Point2D) == 4, "KeypointProtocol::Point2D 크기가 변경되었습니다");
+        static_assert(sizeof(Point3D) == 12, "KeypointProtocol::Point3D 크기가 변경되었습니다");
+    } // namespace KeypointProtocol
+} // namespace Utils
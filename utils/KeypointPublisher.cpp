@@ -0,0 +1,142 @@
+#include "KeypointPublisher.h"
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <cerrno>
+#include <cstddef>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Utils {
+    KeypointPublisher::KeypointPublisher(const std::string& socketPath)
+        : socketPath(socketPath), socketFd(-1), addressLength(0), sentCount(0), droppedCount(0) {
+        std::memset(&address, 0, sizeof(address));
+        packetBuffer.reserve(KeypointProtocol::MAX_PACKET_SIZE);
+    }
+
+    KeypointPublisher::~KeypointPublisher() {
+        if (socketFd >= 0) {
+            close(socketFd);
+        }
+    }
+
+    bool KeypointPublisher::open() {
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            std::cerr << "소켓 경로가 너무 깁니다: " << socketPath << std::endl;
+            return false;
+        }
+
+        socketFd = socket(AF_UNIX, SOCK_DGRAM, 0);
+        if (socketFd < 0) {
+            std::cerr << "키포인트 발행 소켓 생성 실패: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+
+        // 전송 시 블록되지 않도록 논블로킹 설정
+        int flags = fcntl(socketFd, F_GETFL, 0);
+        fcntl(socketFd, F_SETFL, flags | O_NONBLOCK);
+
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        addressLength = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + socketPath.size() + 1);
+
+        std::cout << "키포인트 발행 대상: " << socketPath << std::endl;
+        return true;
+    }
+
+    bool KeypointPublisher::publish(uint64_t frameNumber, const PoseResult& result, bool include3d,
+                                    uint16_t cameraIndex) {
+        if (socketFd < 0) return false;
+
+        uint16_t numPersons = static_cast<uint16_t>(result.numPersons);
+        uint16_t numKeypoints = result.numPersons > 0 ? static_cast<uint16_t>(result.numKeypoints) : 0;
+        bool has3d = include3d && result.has3D();
+
+        size_t pointCount = static_cast<size_t>(numPersons) * numKeypoints;
+        size_t packetSize = sizeof(KeypointProtocol::Header) + pointCount * sizeof(KeypointProtocol::Point2D);
+        if (has3d) {
+            packetSize += pointCount * sizeof(KeypointProtocol::Point3D);
+        }
+        if (packetSize > static_cast<size_t>(KeypointProtocol::MAX_PACKET_SIZE)) {
+            droppedCount++;
+            return false;
+        }
+        packetBuffer.resize(packetSize);
+
+        // 헤더 작성
+        KeypointProtocol::Header header;
+        header.magic = KeypointProtocol::MAGIC;
+        header.version = KeypointProtocol::VERSION;
+        header.flags = has3d ? KeypointProtocol::FLAG_HAS_3D : 0;
+        header.frameNumber = frameNumber;
+        header.timestampUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        header.numPersons = numPersons;
+        header.numKeypoints = numKeypoints;
+        header.cameraIndex = cameraIndex;
+        header.reserved = 0;
+
+        char* cursor = packetBuffer.data();
+        std::memcpy(cursor, &header, sizeof(header));
+        cursor += sizeof(header);
+
+        // 2D 키포인트
+        packKeypoints(result, numKeypoints, packed2d);
+        if (pointCount > 0) {
+            std::memcpy(cursor, packed2d.data(), pointCount * sizeof(KeypointProtocol::Point2D));
+        }
+        cursor += pointCount * sizeof(KeypointProtocol::Point2D);
+
+        // 3D 키포인트
+        if (has3d && pointCount > 0) {
+            packKeypoints3D(result, numKeypoints, packed3d);
+            std::memcpy(cursor, packed3d.data(), pointCount * sizeof(KeypointProtocol::Point3D));
+        }
+
+        // 논블로킹 전송 - 구독자 부재(ENOENT/ECONNREFUSED)나 버퍼 가득 참(EAGAIN)은 드롭으로 처리
+        ssize_t sent = sendto(socketFd, packetBuffer.data(), packetSize, MSG_DONTWAIT,
+                              reinterpret_cast<const sockaddr*>(&address), addressLength);
+        if (sent != static_cast<ssize_t>(packetSize)) {
+            droppedCount++;
+            return false;
+        }
+
+        sentCount++;
+        return true;
+    }
+
+    void KeypointPublisher::packKeypoints(const PoseResult& result, int numKeypoints,
+                                          std::vector<KeypointProtocol::Point2D>& packed) {
+        packed.resize(static_cast<size_t>(result.numPersons) * numKeypoints);
+        size_t index = 0;
+        for (int p = 0; p < result.numPersons; p++) {
+            for (int k = 0; k < numKeypoints; k++, index++) {
+                bool valid = k < result.numKeypoints && result.isVisible(p, k);
+                packed[index].x = valid ? static_cast<int16_t>(result.x[p][k]) : -1;
+                packed[index].y = valid ? static_cast<int16_t>(result.y[p][k]) : -1;
+            }
+        }
+    }
+
+    void KeypointPublisher::packKeypoints3D(const PoseResult& result, int numKeypoints,
+                                            std::vector<KeypointProtocol::Point3D>& packed) {
+        packed.resize(static_cast<size_t>(result.numPersons) * numKeypoints);
+        size_t index = 0;
+        for (int p = 0; p < result.numPersons; p++) {
+            for (int k = 0; k < numKeypoints; k++, index++) {
+                bool valid = k < result.numKeypoints && result.has3D();
+                packed[index].x = valid ? result.cameraX[p][k] : 0.0f;
+                packed[index].y = valid ? result.cameraY[p][k] : 0.0f;
+                packed[index].z = valid ? result.cameraZ[p][k] : 0.0f;
+            }
+        }
+    }
+
+    uint64_t KeypointPublisher::getSentCount() const {
+        return sentCount;
+    }
+
+    uint64_t KeypointPublisher::getDroppedCount() const {
+        return droppedCount;
+    }
+}
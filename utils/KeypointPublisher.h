@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "KeypointProtocol.h"
+#include "../PoseResult.h"
+
+namespace Utils {
+    // 키포인트를 Unix 도메인 데이터그램 소켓으로 발행하는 클래스
+    // - 전송은 MSG_DONTWAIT로 수행되어 추론 스레드를 절대 블록하지 않음
+    // - 구독자가 없거나 수신 버퍼가 가득 차면 해당 프레임은 버리고 드롭 카운트 증가
+    class KeypointPublisher {
+    public:
+        KeypointPublisher(const std::string& socketPath);
+        ~KeypointPublisher();
+
+        // 소켓 생성
+        bool open();
+
+        // 키포인트 발행 (include3d이고 결과에 3D 좌표가 있을 때만 3D 포함)
+        bool publish(uint64_t frameNumber, const PoseResult& result, bool include3d, uint16_t cameraIndex = 0);
+
+        // 포즈 결과를 프로토콜 형식의 평탄한 배열로 변환 (사람 순서, 키포인트 순서)
+        // - 검출되지 않은 관절은 2D (-1, -1), 3D (0, 0, 0)
+        static void packKeypoints(const PoseResult& result, int numKeypoints,
+                                  std::vector<KeypointProtocol::Point2D>& packed);
+        static void packKeypoints3D(const PoseResult& result, int numKeypoints,
+                                    std::vector<KeypointProtocol::Point3D>& packed);
+
+        // 전송/드롭 통계
+        uint64_t getSentCount() const;
+        uint64_t getDroppedCount() const;
+
+    private:
+        std::string socketPath;
+        int socketFd;
+        sockaddr_un address;
+        socklen_t addressLength;
+
+        // 패킷 직렬화용 재사용 버퍼
+        std::vector<char> packetBuffer;
+        std::vector<KeypointProtocol::Point2D> packed2d;
+        std::vector<KeypointProtocol::Point3D> packed3d;
+
+        uint64_t sentCount;
+        uint64_t droppedCount;
+    };
+}
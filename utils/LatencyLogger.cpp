@@ -0,0 +1,53 @@
+#include "LatencyLogger.h"
+#include <iostream>
+#include <iomanip>
+
+namespace Utils {
+    LatencyLogger::LatencyLogger(const std::string& path, const std::string& format)
+        : path(path), json(format == "json") {
+    }
+
+    bool LatencyLogger::open() {
+        file.open(path, std::ios::out | std::ios::trunc);
+        if (!file) {
+            std::cerr << "지연 로그 파일을 열 수 없습니다: " << path << std::endl;
+            return false;
+        }
+
+        file << std::fixed << std::setprecision(3);
+        if (!json) {
+            file << "frame,sensor_ms,arrival_ms,acquired_ms,depth_done_ms,pose_done_ms,render_done_ms,"
+                 << "sensor_to_arrival_ms,arrival_to_acquire_ms,depth_ms,pose_ms,render_ms,end_to_end_ms\n";
+        }
+
+        std::cout << "프레임 지연 로그: " << path << std::endl;
+        return true;
+    }
+
+    void LatencyLogger::log(const FrameTiming& timing) {
+        if (!file) return;
+
+        FrameTiming::Breakdown latency = timing.breakdown();
+        if (json) {
+            file << "{\"frame\":" << timing.frameNumber
+                 << ",\"sensor_ms\":" << timing.sensorMs
+                 << ",\"arrival_ms\":" << timing.arrivalMs
+                 << ",\"acquired_ms\":" << timing.acquiredMs
+                 << ",\"depth_done_ms\":" << timing.depthDoneMs
+                 << ",\"pose_done_ms\":" << timing.poseDoneMs
+                 << ",\"render_done_ms\":" << timing.renderDoneMs
+                 << ",\"sensor_to_arrival_ms\":" << latency.sensorToArrivalMs
+                 << ",\"arrival_to_acquire_ms\":" << latency.arrivalToAcquireMs
+                 << ",\"depth_ms\":" << latency.depthMs
+                 << ",\"pose_ms\":" << latency.poseMs
+                 << ",\"render_ms\":" << latency.renderMs
+                 << ",\"end_to_end_ms\":" << latency.endToEndMs << "}\n";
+        } else {
+            file << timing.frameNumber << ',' << timing.sensorMs << ',' << timing.arrivalMs << ','
+                 << timing.acquiredMs << ',' << timing.depthDoneMs << ',' << timing.poseDoneMs << ','
+                 << timing.renderDoneMs << ',' << latency.sensorToArrivalMs << ',' << latency.arrivalToAcquireMs << ','
+                 << latency.depthMs << ',' << latency.poseMs << ',' << latency.renderMs << ','
+                 << latency.endToEndMs << '\n';
+        }
+    }
+}
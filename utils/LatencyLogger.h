@@ -0,0 +1,23 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include "FrameTiming.h"
+
+namespace Utils {
+    // 프레임별 지연 측정 결과를 CSV 또는 JSON Lines 파일로 기록
+    class LatencyLogger {
+    public:
+        // format: "csv" 또는 "json"
+        LatencyLogger(const std::string& path, const std::string& format);
+
+        bool open();
+
+        void log(const FrameTiming& timing);
+
+    private:
+        std::string path;
+        bool json;
+        std::ofstream file;
+    };
+}
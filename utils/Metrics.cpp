@@ -0,0 +1,201 @@
+#include "Metrics.h"
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace Utils {
+    namespace Metrics {
+        void Gauge::set(double value) {
+            uint64_t raw;
+            std::memcpy(&raw, &value, sizeof(raw));
+            bits.store(raw, std::memory_order_relaxed);
+        }
+
+        double Gauge::get() const {
+            uint64_t raw = bits.load(std::memory_order_relaxed);
+            double value;
+            std::memcpy(&value, &raw, sizeof(value));
+            return value;
+        }
+
+        Histogram::Histogram(const std::vector<double>& bounds)
+            : bounds(bounds), buckets(new std::atomic<uint64_t>[bounds.size() + 1]), count(0), sumMicros(0) {
+            for (size_t i = 0; i <= bounds.size(); i++) {
+                buckets[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        void Histogram::observe(double value) {
+            // 버킷 수가 작고 고정되어 있으므로 선형 탐색 (분기 예측에 유리)
+            size_t index = 0;
+            while (index < bounds.size() && value > bounds[index]) {
+                index++;
+            }
+            buckets[index].fetch_add(1, std::memory_order_relaxed);
+            count.fetch_add(1, std::memory_order_relaxed);
+            if (value > 0.0) {
+                sumMicros.fetch_add(static_cast<uint64_t>(value * 1e6), std::memory_order_relaxed);
+            }
+        }
+
+        const std::vector<double>& Histogram::getBounds() const {
+            return bounds;
+        }
+
+        uint64_t Histogram::getBucketCount(size_t index) const {
+            return buckets[index].load(std::memory_order_relaxed);
+        }
+
+        uint64_t Histogram::getCount() const {
+            return count.load(std::memory_order_relaxed);
+        }
+
+        double Histogram::getSum() const {
+            return sumMicros.load(std::memory_order_relaxed) / 1e6;
+        }
+
+        std::vector<double> defaultLatencyBounds() {
+            return {0.001, 0.0025, 0.005, 0.01, 0.02, 0.033, 0.05, 0.1, 0.25, 0.5, 1.0};
+        }
+
+        Registry& Registry::instance() {
+            static Registry registry;
+            return registry;
+        }
+
+        Registry::Entry* Registry::find(const std::string& name, const std::string& labels) {
+            for (auto& entry : entries) {
+                if (entry.name == name && entry.labels == labels) {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        Counter& Registry::counter(const std::string& name, const std::string& help, const std::string& labels) {
+            std::lock_guard<std::mutex> lock(mutex);
+            Entry* existing = find(name, labels);
+            if (existing && existing->counter) {
+                return *existing->counter;
+            }
+            entries.emplace_back();
+            Entry& entry = entries.back();
+            entry.name = name;
+            entry.help = help;
+            entry.labels = labels;
+            entry.type = Type::Counter;
+            entry.counter.reset(new Counter());
+            return *entry.counter;
+        }
+
+        Gauge& Registry::gauge(const std::string& name, const std::string& help, const std::string& labels) {
+            std::lock_guard<std::mutex> lock(mutex);
+            Entry* existing = find(name, labels);
+            if (existing && existing->gauge) {
+                return *existing->gauge;
+            }
+            entries.emplace_back();
+            Entry& entry = entries.back();
+            entry.name = name;
+            entry.help = help;
+            entry.labels = labels;
+            entry.type = Type::Gauge;
+            entry.gauge.reset(new Gauge());
+            return *entry.gauge;
+        }
+
+        Histogram& Registry::histogram(const std::string& name, const std::string& help, const std::string& labels,
+                                       const std::vector<double>& bounds) {
+            std::lock_guard<std::mutex> lock(mutex);
+            Entry* existing = find(name, labels);
+            if (existing && existing->histogram) {
+                return *existing->histogram;
+            }
+            entries.emplace_back();
+            Entry& entry = entries.back();
+            entry.name = name;
+            entry.help = help;
+            entry.labels = labels;
+            entry.type = Type::Histogram;
+            entry.histogram.reset(new Histogram(bounds));
+            return *entry.histogram;
+        }
+
+        void Registry::collectProcessMetrics() {
+            // VmRSS / VmHWM 값은 kB 단위
+            std::ifstream status("/proc/self/status");
+            std::string line;
+            while (std::getline(status, line)) {
+                std::istringstream iss(line);
+                std::string key;
+                double kilobytes = 0.0;
+                iss >> key >> kilobytes;
+                if (key == "VmRSS:") {
+                    gauge("process_resident_memory_bytes", "Resident memory size in bytes").set(kilobytes * 1024.0);
+                } else if (key == "VmHWM:") {
+                    gauge("process_resident_memory_peak_bytes", "Peak resident memory size in bytes").set(kilobytes * 1024.0);
+                } else if (key == "VmSize:") {
+                    gauge("process_virtual_memory_bytes", "Virtual memory size in bytes").set(kilobytes * 1024.0);
+                }
+            }
+        }
+
+        namespace {
+            std::string formatLabels(const std::string& labels, const std::string& extra = "") {
+                if (labels.empty() && extra.empty()) return "";
+                if (labels.empty()) return "{" + extra + "}";
+                if (extra.empty()) return "{" + labels + "}";
+                return "{" + labels + "," + extra + "}";
+            }
+
+            const char* typeName(bool counter, bool gauge) {
+                return counter ? "counter" : (gauge ? "gauge" : "histogram");
+            }
+        }
+
+        std::string Registry::renderPrometheus() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::ostringstream out;
+            out.precision(12);
+
+            // 같은 이름의 항목은 등록 순서와 관계없이 하나의 패밀리로 묶어서 출력
+            std::vector<bool> written(entries.size(), false);
+            for (size_t i = 0; i < entries.size(); i++) {
+                if (written[i]) continue;
+                const Entry& family = entries[i];
+                out << "# HELP " << family.name << " " << family.help << "\n";
+                out << "# TYPE " << family.name << " "
+                    << typeName(family.type == Type::Counter, family.type == Type::Gauge) << "\n";
+
+                for (size_t j = i; j < entries.size(); j++) {
+                    const Entry& entry = entries[j];
+                    if (written[j] || entry.name != family.name) continue;
+                    written[j] = true;
+
+                    if (entry.type == Type::Counter) {
+                        out << entry.name << formatLabels(entry.labels) << " " << entry.counter->get() << "\n";
+                    } else if (entry.type == Type::Gauge) {
+                        out << entry.name << formatLabels(entry.labels) << " " << entry.gauge->get() << "\n";
+                    } else {
+                        const Histogram& histogram = *entry.histogram;
+                        const std::vector<double>& bounds = histogram.getBounds();
+                        uint64_t cumulative = 0;
+                        for (size_t b = 0; b < bounds.size(); b++) {
+                            cumulative += histogram.getBucketCount(b);
+                            std::ostringstream le;
+                            le << "le=\"" << bounds[b] << "\"";
+                            out << entry.name << "_bucket" << formatLabels(entry.labels, le.str()) << " " << cumulative << "\n";
+                        }
+                        cumulative += histogram.getBucketCount(bounds.size());
+                        out << entry.name << "_bucket" << formatLabels(entry.labels, "le=\"+Inf\"") << " " << cumulative << "\n";
+                        out << entry.name << "_sum" << formatLabels(entry.labels) << " " << histogram.getSum() << "\n";
+                        out << entry.name << "_count" << formatLabels(entry.labels) << " " << cumulative << "\n";
+                    }
+                }
+            }
+
+            return out.str();
+        }
+    } // namespace Metrics
+} // namespace Utils
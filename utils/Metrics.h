@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Utils {
+    namespace Metrics {
+        // 단조 증가 카운터 - 기록은 wait-free (fetch_add)
+        class Counter {
+        public:
+            Counter() : value(0) {}
+
+            void increment(uint64_t amount = 1) {
+                value.fetch_add(amount, std::memory_order_relaxed);
+            }
+
+            uint64_t get() const {
+                return value.load(std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic<uint64_t> value;
+        };
+
+        // 현재 값 게이지 - double 비트를 원자적으로 저장 (wait-free)
+        class Gauge {
+        public:
+            Gauge() : bits(0) {}
+
+            void set(double value);
+            double get() const;
+
+        private:
+            std::atomic<uint64_t> bits;
+        };
+
+        // 고정 버킷 히스토그램 - 버킷 경계는 생성 시 고정, 기록은 wait-free
+        // 합계는 마이크로 단위 정수로 누적 (초 단위 지연이면 마이크로초)
+        class Histogram {
+        public:
+            explicit Histogram(const std::vector<double>& bounds);
+
+            void observe(double value);
+
+            const std::vector<double>& getBounds() const;
+            uint64_t getBucketCount(size_t index) const; // index == bounds.size()는 +Inf 버킷
+            uint64_t getCount() const;
+            double getSum() const;
+
+        private:
+            std::vector<double> bounds;
+            std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+            std::atomic<uint64_t> count;
+            std::atomic<uint64_t> sumMicros;
+        };
+
+        // 지연 시간 히스토그램 기본 버킷 (초)
+        std::vector<double> defaultLatencyBounds();
+
+        // 메트릭 레지스트리 - 등록은 시작 시 (뮤텍스), 기록은 반환된 참조로 직접 수행
+        // 반환된 참조는 프로세스 종료까지 유효
+        class Registry {
+        public:
+            static Registry& instance();
+
+            // labels 예: "stage=\"infer\"" (같은 이름은 하나의 메트릭 패밀리로 출력)
+            Counter& counter(const std::string& name, const std::string& help, const std::string& labels = "");
+            Gauge& gauge(const std::string& name, const std::string& help, const std::string& labels = "");
+            Histogram& histogram(const std::string& name, const std::string& help, const std::string& labels = "",
+                                 const std::vector<double>& bounds = defaultLatencyBounds());
+
+            // 프로세스 메모리 게이지 갱신 (/proc/self/status)
+            void collectProcessMetrics();
+
+            // Prometheus 텍스트 형식(0.0.4)으로 출력
+            std::string renderPrometheus() const;
+
+        private:
+            Registry() = default;
+
+            enum class Type { Counter, Gauge, Histogram };
+
+            struct Entry {
+                std::string name;
+                std::string help;
+                std::string labels;
+                Type type;
+                std::unique_ptr<Counter> counter;
+                std::unique_ptr<Gauge> gauge;
+                std::unique_ptr<Histogram> histogram;
+            };
+
+            mutable std::mutex mutex;
+            std::deque<Entry> entries;
+
+            Entry* find(const std::string& name, const std::string& labels);
+        };
+
+        // 범위 종료 시 경과 시간(초)을 히스토그램에 기록
+        class ScopedTimer {
+        public:
+            explicit ScopedTimer(Histogram& histogram)
+                : histogram(histogram), start(std::chrono::steady_clock::now()) {}
+
+            ~ScopedTimer() {
+                histogram.observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            }
+
+        private:
+            Histogram& histogram;
+            std::chrono::steady_clock::time_point start;
+        };
+    } // namespace Metrics
+} // namespace Utils
@@ -0,0 +1,131 @@
+#include "MetricsServer.h"
+#include "Metrics.h"
+#include <iostream>
+#include <sstream>
+#include <cstring>
+#include <cerrno>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace Utils {
+    MetricsServer::MetricsServer(const std::string& bindAddress, int port)
+        : bindAddress(bindAddress), port(port), listenFd(-1), running(false) {
+    }
+
+    MetricsServer::~MetricsServer() {
+        stop();
+    }
+
+    bool MetricsServer::start() {
+        listenFd = socket(AF_INET, SOCK_STREAM, 0);
+        if (listenFd < 0) {
+            std::cerr << "메트릭 서버 소켓 생성 실패: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+
+        int reuse = 1;
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(port));
+        if (inet_pton(AF_INET, bindAddress.c_str(), &address.sin_addr) != 1) {
+            std::cerr << "메트릭 서버 주소가 올바르지 않습니다: " << bindAddress << std::endl;
+            close(listenFd);
+            listenFd = -1;
+            return false;
+        }
+
+        if (bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+            listen(listenFd, 8) < 0) {
+            std::cerr << "메트릭 서버 바인딩 실패 (" << bindAddress << ":" << port << "): "
+                      << std::strerror(errno) << std::endl;
+            close(listenFd);
+            listenFd = -1;
+            return false;
+        }
+
+        running = true;
+        serverThread = std::thread(&MetricsServer::serve, this);
+
+        std::cout << "메트릭 엔드포인트: http://" << bindAddress << ":" << port << "/metrics" << std::endl;
+        return true;
+    }
+
+    void MetricsServer::stop() {
+        running = false;
+        if (serverThread.joinable()) {
+            serverThread.join();
+        }
+        if (listenFd >= 0) {
+            close(listenFd);
+            listenFd = -1;
+        }
+    }
+
+    void MetricsServer::serve() {
+        while (running) {
+            // 종료 플래그 확인을 위해 짧은 타임아웃으로 대기
+            pollfd fds;
+            fds.fd = listenFd;
+            fds.events = POLLIN;
+            fds.revents = 0;
+            if (poll(&fds, 1, 200) <= 0) {
+                continue;
+            }
+
+            int clientFd = accept(listenFd, nullptr, nullptr);
+            if (clientFd < 0) {
+                continue;
+            }
+            handleClient(clientFd);
+            close(clientFd);
+        }
+    }
+
+    void MetricsServer::handleClient(int clientFd) {
+        // 느린 클라이언트가 서버 스레드를 붙잡지 않도록 수신 타임아웃 설정
+        timeval timeout;
+        timeout.tv_sec = 1;
+        timeout.tv_usec = 0;
+        setsockopt(clientFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        char request[1024];
+        ssize_t received = recv(clientFd, request, sizeof(request) - 1, 0);
+        if (received <= 0) {
+            return;
+        }
+        request[received] = '\0';
+
+        std::string body;
+        std::string status;
+        if (std::strncmp(request, "GET /metrics", 12) == 0) {
+            Metrics::Registry& registry = Metrics::Registry::instance();
+            registry.collectProcessMetrics();
+            body = registry.renderPrometheus();
+            status = "200 OK";
+        } else {
+            body = "Not Found\n";
+            status = "404 Not Found";
+        }
+
+        std::ostringstream response;
+        response << "HTTP/1.1 " << status << "\r\n"
+                 << "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                 << "Content-Length: " << body.size() << "\r\n"
+                 << "Connection: close\r\n\r\n"
+                 << body;
+
+        std::string data = response.str();
+        size_t offset = 0;
+        while (offset < data.size()) {
+            ssize_t sent = send(clientFd, data.data() + offset, data.size() - offset, MSG_NOSIGNAL);
+            if (sent <= 0) break;
+            offset += static_cast<size_t>(sent);
+        }
+    }
+}
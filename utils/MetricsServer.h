@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace Utils {
+    // Prometheus 스크레이프용 최소 HTTP 서버
+    // - 전용 스레드에서 GET /metrics 요청에만 응답 (그 외 경로는 404)
+    // - 파이프라인 스레드와는 메트릭 레지스트리의 원자 값으로만 통신
+    class MetricsServer {
+    public:
+        MetricsServer(const std::string& bindAddress, int port);
+        ~MetricsServer();
+
+        // 소켓 바인딩 후 서버 스레드 시작
+        bool start();
+
+        // 서버 스레드 종료
+        void stop();
+
+    private:
+        std::string bindAddress;
+        int port;
+        int listenFd;
+        std::atomic<bool> running;
+        std::thread serverThread;
+
+        void serve();
+        void handleClient(int clientFd);
+    };
+}
@@ -0,0 +1,146 @@
+#include "PoseColumnWriter.h"
+#include <iostream>
+#include <algorithm>
+
+namespace Utils {
+    PoseColumnWriter::PoseColumnWriter(int numKeypoints) : numKeypoints(numKeypoints) {
+        sourceOffsets.push_back(0);
+    }
+
+    bool PoseColumnWriter::open(const std::string& path, bool append) {
+        if (append) {
+            // 기존 파일 헤더가 같은 키포인트 수로 기록되었는지 확인
+            std::ifstream existing(path, std::ios::binary);
+            if (existing) {
+                uint32_t magic = 0;
+                uint16_t version = 0;
+                uint16_t keypoints = 0;
+                existing.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+                existing.read(reinterpret_cast<char*>(&version), sizeof(version));
+                existing.read(reinterpret_cast<char*>(&keypoints), sizeof(keypoints));
+                if (!existing || magic != kFileMagic || version != kVersion || keypoints != numKeypoints) {
+                    std::cerr << "기존 출력 파일 형식이 맞지 않습니다: " << path << std::endl;
+                    return false;
+                }
+                existing.close();
+
+                file.open(path, std::ios::binary | std::ios::app);
+                if (!file) {
+                    std::cerr << "파일을 열 수 없습니다: " << path << std::endl;
+                    return false;
+                }
+                file.seekp(0, std::ios::end);
+                return true;
+            }
+        }
+
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "파일을 열 수 없습니다: " << path << std::endl;
+            return false;
+        }
+
+        uint32_t magic = kFileMagic;
+        uint16_t version = kVersion;
+        uint16_t keypoints = static_cast<uint16_t>(numKeypoints);
+        uint32_t flags = 0;
+        uint32_t reserved = 0;
+        file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        file.write(reinterpret_cast<const char*>(&keypoints), sizeof(keypoints));
+        file.write(reinterpret_cast<const char*>(&flags), sizeof(flags));
+        file.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+        file.flush();
+        return static_cast<bool>(file);
+    }
+
+    void PoseColumnWriter::add(const std::string& source, const PoseResult& result) {
+        uint32_t frame = static_cast<uint32_t>(sourceOffsets.size() - 1);
+        sources += source;
+        sourceOffsets.push_back(static_cast<uint32_t>(sources.size()));
+
+        int keypoints = std::min(static_cast<int>(result.numKeypoints), numKeypoints);
+        for (int p = 0; p < result.numPersons; p++) {
+            frameColumn.push_back(frame);
+            personColumn.push_back(static_cast<uint16_t>(p));
+            flagsColumn.push_back(result.flags);
+
+            // 모델 키포인트 수가 적으면 나머지 열은 0으로 채움
+            for (int k = 0; k < numKeypoints; k++) {
+                bool valid = k < keypoints;
+                xColumn.push_back(valid ? result.x[p][k] : 0.0f);
+                yColumn.push_back(valid ? result.y[p][k] : 0.0f);
+                scoreColumn.push_back(valid ? result.score[p][k] : 0.0f);
+                cameraXColumn.push_back(valid ? result.cameraX[p][k] : 0.0f);
+                cameraYColumn.push_back(valid ? result.cameraY[p][k] : 0.0f);
+                cameraZColumn.push_back(valid ? result.cameraZ[p][k] : 0.0f);
+            }
+        }
+    }
+
+    template <typename T>
+    void PoseColumnWriter::writeColumn(const std::vector<T>& column) {
+        if (!column.empty()) {
+            file.write(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+        }
+    }
+
+    int64_t PoseColumnWriter::flushGroup() {
+        if (!file) {
+            return -1;
+        }
+
+        uint32_t frameCount = static_cast<uint32_t>(sourceOffsets.size() - 1);
+        if (frameCount > 0) {
+            uint32_t magic = kGroupMagic;
+            uint32_t rowCount = static_cast<uint32_t>(frameColumn.size());
+            uint32_t sourceBytes = static_cast<uint32_t>(sources.size());
+            file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+            file.write(reinterpret_cast<const char*>(&frameCount), sizeof(frameCount));
+            file.write(reinterpret_cast<const char*>(&rowCount), sizeof(rowCount));
+            file.write(reinterpret_cast<const char*>(&sourceBytes), sizeof(sourceBytes));
+
+            writeColumn(sourceOffsets);
+            file.write(sources.data(), sources.size());
+            writeColumn(frameColumn);
+            writeColumn(personColumn);
+            writeColumn(flagsColumn);
+            writeColumn(xColumn);
+            writeColumn(yColumn);
+            writeColumn(scoreColumn);
+            writeColumn(cameraXColumn);
+            writeColumn(cameraYColumn);
+            writeColumn(cameraZColumn);
+        }
+        file.flush();
+
+        // 다음 그룹을 위해 버퍼 비우기 (용량은 유지)
+        sourceOffsets.resize(1);
+        sources.clear();
+        frameColumn.clear();
+        personColumn.clear();
+        flagsColumn.clear();
+        xColumn.clear();
+        yColumn.clear();
+        scoreColumn.clear();
+        cameraXColumn.clear();
+        cameraYColumn.clear();
+        cameraZColumn.clear();
+
+        if (!file) {
+            return -1;
+        }
+        return static_cast<int64_t>(file.tellp());
+    }
+
+    size_t PoseColumnWriter::getPendingFrames() const {
+        return sourceOffsets.size() - 1;
+    }
+
+    void PoseColumnWriter::close() {
+        if (file.is_open()) {
+            flushGroup();
+            file.close();
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include "../PoseResult.h"
+
+namespace Utils {
+    // 프레임별 포즈 결과를 열(column) 단위 행 그룹으로 기록하는 단일 파일 작성기
+    // - 파일 헤더 뒤에 행 그룹이 이어 붙고, 행 하나는 (프레임, 사람) 한 쌍
+    // - 행 그룹마다 같은 종류의 값이 연속으로 놓여 열 하나만 읽거나 압축하기 쉬움
+    //
+    // 파일 헤더 (16바이트, 리틀 엔디언)
+    //   uint32 magic ("RPCF"), uint16 version, uint16 numKeypoints, uint32 flags, uint32 reserved
+    // 행 그룹
+    //   uint32 magic ("RGRP"), uint32 frameCount, uint32 rowCount, uint32 sourceBytes
+    //   frameCount개 프레임: uint32 sourceOffsets[frameCount + 1], char sources[sourceBytes] (원본 경로)
+    //   rowCount개 행: uint32 frame[rows] (그룹 내 프레임 번호), uint16 person[rows], uint16 flags[rows],
+    //                   float x/y/score/cameraX/cameraY/cameraZ[rows][numKeypoints]
+    // - 사람이 검출되지 않은 프레임은 sources에만 남고 행은 없음
+    class PoseColumnWriter {
+    public:
+        static const uint32_t kFileMagic = 0x46435052;  // "RPCF"
+        static const uint32_t kGroupMagic = 0x50524752; // "RGRP"
+        static const uint16_t kVersion = 1;
+
+        explicit PoseColumnWriter(int numKeypoints);
+
+        // 파일 열기 - append이면 이미 있는 파일의 헤더를 확인하고 끝에 이어 씀
+        bool open(const std::string& path, bool append);
+
+        // 현재 행 그룹에 프레임 하나 추가 (결과의 모든 사람이 행이 됨)
+        void add(const std::string& source, const PoseResult& result);
+
+        // 모아 둔 행 그룹을 파일에 기록하고 flush - 기록 후 파일 크기(바이트), 실패 시 -1
+        int64_t flushGroup();
+
+        // 현재 행 그룹에 쌓인 프레임 수
+        size_t getPendingFrames() const;
+
+        void close();
+
+    private:
+        template <typename T>
+        void writeColumn(const std::vector<T>& column);
+
+        int numKeypoints;
+        std::ofstream file;
+
+        // 현재 행 그룹 버퍼 (그룹 단위로 재사용)
+        std::vector<uint32_t> sourceOffsets;
+        std::string sources;
+        std::vector<uint32_t> frameColumn;
+        std::vector<uint16_t> personColumn;
+        std::vector<uint16_t> flagsColumn;
+        std::vector<float> xColumn;
+        std::vector<float> yColumn;
+        std::vector<float> scoreColumn;
+        std::vector<float> cameraXColumn;
+        std::vector<float> cameraYColumn;
+        std::vector<float> cameraZColumn;
+    };
+}
@@ -0,0 +1,320 @@
+#include "SharedFrameRing.h"
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <new>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace Utils {
+    namespace SharedFrameRing {
+        namespace {
+            const size_t ALIGNMENT = 64;
+
+            size_t alignUp(size_t value) {
+                return (value + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+            }
+        }
+
+        // ---------------- Writer ----------------
+
+        Writer::Writer(const std::string& name, int slotCount)
+            : name(name), slotCount(slotCount), fd(-1), mapping(nullptr), mappingSize(0),
+              header(nullptr), sequence(0) {
+        }
+
+        Writer::~Writer() {
+            if (mapping) {
+                munmap(mapping, mappingSize);
+            }
+            if (fd >= 0) {
+                close(fd);
+                shm_unlink(name.c_str());
+            }
+        }
+
+        bool Writer::create(int colorWidth, int colorHeight, int colorBytesPerPixel,
+                            int depthWidth, int depthHeight, float depthScale,
+                            int maxPersons, int maxKeypoints) {
+            if (slotCount < 2) {
+                std::cerr << "공유 메모리 링 슬롯 수는 2 이상이어야 합니다: " << slotCount << std::endl;
+                return false;
+            }
+
+            // 슬롯 레이아웃 계산
+            size_t pointCount = static_cast<size_t>(maxPersons) * maxKeypoints;
+            size_t keypoints2dOffset = alignUp(sizeof(SlotHeader));
+            size_t keypoints3dOffset = alignUp(keypoints2dOffset + pointCount * sizeof(KeypointProtocol::Point2D));
+            size_t colorOffset = alignUp(keypoints3dOffset + pointCount * sizeof(KeypointProtocol::Point3D));
+            size_t depthOffset = alignUp(colorOffset + static_cast<size_t>(colorWidth) * colorHeight * colorBytesPerPixel);
+            size_t slotStride = alignUp(depthOffset + static_cast<size_t>(depthWidth) * depthHeight * sizeof(uint16_t));
+            size_t slotsOffset = alignUp(sizeof(RingHeader));
+
+            mappingSize = slotsOffset + slotStride * slotCount;
+
+            // 이전 실행에서 남은 세그먼트 제거 후 생성
+            shm_unlink(name.c_str());
+            fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+            if (fd < 0) {
+                std::cerr << "공유 메모리 생성 실패 (" << name << "): " << std::strerror(errno) << std::endl;
+                return false;
+            }
+            if (ftruncate(fd, static_cast<off_t>(mappingSize)) != 0) {
+                std::cerr << "공유 메모리 크기 설정 실패: " << std::strerror(errno) << std::endl;
+                return false;
+            }
+
+            mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+                std::cerr << "공유 메모리 매핑 실패: " << std::strerror(errno) << std::endl;
+                return false;
+            }
+
+            // 헤더 초기화 (ftruncate로 0으로 채워진 상태)
+            header = new (mapping) RingHeader;
+            header->version = VERSION;
+            header->slotCount = static_cast<uint32_t>(slotCount);
+            header->slotStride = slotStride;
+            header->slotsOffset = slotsOffset;
+            header->keypoints2dOffset = static_cast<uint32_t>(keypoints2dOffset);
+            header->keypoints3dOffset = static_cast<uint32_t>(keypoints3dOffset);
+            header->colorOffset = static_cast<uint32_t>(colorOffset);
+            header->depthOffset = static_cast<uint32_t>(depthOffset);
+            header->colorWidth = static_cast<uint32_t>(colorWidth);
+            header->colorHeight = static_cast<uint32_t>(colorHeight);
+            header->colorBytesPerPixel = static_cast<uint32_t>(colorBytesPerPixel);
+            header->depthWidth = static_cast<uint32_t>(depthWidth);
+            header->depthHeight = static_cast<uint32_t>(depthHeight);
+            header->depthScale = depthScale;
+            header->maxPersons = static_cast<uint32_t>(maxPersons);
+            header->maxKeypoints = static_cast<uint32_t>(maxKeypoints);
+            header->writeSequence.store(0, std::memory_order_relaxed);
+
+            for (int i = 0; i < slotCount; i++) {
+                SlotHeader* slot = new (slotAt(static_cast<uint64_t>(i))) SlotHeader;
+                slot->sequence.store(0, std::memory_order_relaxed);
+            }
+
+            // 모든 초기화가 보이도록 마지막에 매직 기록
+            header->magic.store(MAGIC, std::memory_order_release);
+
+            std::cout << "공유 메모리 링 생성: " << name << " (" << slotCount << " 슬롯, "
+                      << mappingSize / (1024 * 1024) << " MB)" << std::endl;
+            return true;
+        }
+
+        bool Writer::isCreated() const {
+            return header != nullptr;
+        }
+
+        uint8_t* Writer::slotAt(uint64_t seq) const {
+            return static_cast<uint8_t*>(mapping) + header->slotsOffset + (seq % header->slotCount) * header->slotStride;
+        }
+
+        bool Writer::publish(const Frame& frame) {
+            if (!header) return false;
+
+            // 슬롯 버퍼는 생성 시 크기로 고정 - 크기가 다른 프레임을 행 단위로 복사하면 원본 버퍼 밖을 읽음
+            if ((frame.color && (frame.colorWidth != static_cast<int>(header->colorWidth) ||
+                                 frame.colorHeight != static_cast<int>(header->colorHeight))) ||
+                (frame.depth && (frame.depthWidth != static_cast<int>(header->depthWidth) ||
+                                 frame.depthHeight != static_cast<int>(header->depthHeight)))) {
+                std::cerr << "공유 메모리 링 크기와 프레임 크기가 다릅니다: 컬러 " << frame.colorWidth << "x" << frame.colorHeight
+                          << ", 깊이 " << frame.depthWidth << "x" << frame.depthHeight << " (링 컬러 "
+                          << header->colorWidth << "x" << header->colorHeight << ", 깊이 "
+                          << header->depthWidth << "x" << header->depthHeight << ")" << std::endl;
+                return false;
+            }
+
+            uint64_t next = sequence + 1;
+            uint8_t* base = slotAt(next);
+            SlotHeader* slot = reinterpret_cast<SlotHeader*>(base);
+
+            // 기록 시작 표시 (홀수) - 소비자는 이 값을 보면 슬롯을 무효로 판단
+            slot->sequence.store(2 * next - 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            slot->frameNumber = frame.frameNumber;
+            slot->sensorTimestampMs = frame.sensorTimestampMs;
+            slot->publishTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+
+            // 키포인트 (최대 용량 내에서만 기록)
+            int numPersons = std::min(frame.numPersons, static_cast<int>(header->maxPersons));
+            int numKeypoints = std::min(frame.numKeypoints, static_cast<int>(header->maxKeypoints));
+            slot->numPersons = static_cast<uint32_t>(numPersons);
+            slot->numKeypoints = static_cast<uint32_t>(numKeypoints);
+            slot->flags = frame.keypoints3d ? KeypointProtocol::FLAG_HAS_3D : 0;
+
+            size_t pointCount = static_cast<size_t>(numPersons) * numKeypoints;
+            if (frame.keypoints2d && pointCount > 0) {
+                std::memcpy(base + header->keypoints2dOffset, frame.keypoints2d,
+                            pointCount * sizeof(KeypointProtocol::Point2D));
+            }
+            if (frame.keypoints3d && pointCount > 0) {
+                std::memcpy(base + header->keypoints3dOffset, frame.keypoints3d,
+                            pointCount * sizeof(KeypointProtocol::Point3D));
+            }
+
+            // 컬러 프레임 (행 단위 복사 - 원본 stride 대응)
+            if (frame.color) {
+                size_t rowBytes = static_cast<size_t>(header->colorWidth) * header->colorBytesPerPixel;
+                uint8_t* dst = base + header->colorOffset;
+                for (uint32_t y = 0; y < header->colorHeight; y++) {
+                    std::memcpy(dst + y * rowBytes, frame.color + y * frame.colorStride, rowBytes);
+                }
+            }
+
+            // 깊이 프레임 (원본 Z16)
+            if (frame.depth) {
+                size_t rowBytes = static_cast<size_t>(header->depthWidth) * sizeof(uint16_t);
+                uint8_t* dst = base + header->depthOffset;
+                const uint8_t* src = reinterpret_cast<const uint8_t*>(frame.depth);
+                for (uint32_t y = 0; y < header->depthHeight; y++) {
+                    std::memcpy(dst + y * rowBytes, src + y * frame.depthStride, rowBytes);
+                }
+            }
+
+            // 기록 완료 표시 (짝수) 후 링 전체 시퀀스 갱신
+            slot->sequence.store(2 * next, std::memory_order_release);
+            header->writeSequence.store(next, std::memory_order_release);
+            sequence = next;
+            return true;
+        }
+
+        uint64_t Writer::getWriteSequence() const {
+            return sequence;
+        }
+
+        // ---------------- Reader ----------------
+
+        Reader::Reader(const std::string& name)
+            : name(name), fd(-1), mapping(nullptr), mappingSize(0), header(nullptr),
+              nextSequence(0), overrunCount(0) {
+        }
+
+        Reader::~Reader() {
+            if (mapping) {
+                munmap(mapping, mappingSize);
+            }
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+
+        bool Reader::attach() {
+            fd = shm_open(name.c_str(), O_RDONLY, 0);
+            if (fd < 0) {
+                std::cerr << "공유 메모리 열기 실패 (" << name << "): " << std::strerror(errno) << std::endl;
+                return false;
+            }
+
+            struct stat info;
+            if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(RingHeader)) {
+                std::cerr << "공유 메모리 링이 아직 초기화되지 않았습니다: " << name << std::endl;
+                return false;
+            }
+            mappingSize = static_cast<size_t>(info.st_size);
+
+            mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+                std::cerr << "공유 메모리 매핑 실패: " << std::strerror(errno) << std::endl;
+                return false;
+            }
+
+            header = static_cast<const RingHeader*>(mapping);
+            if (header->magic.load(std::memory_order_acquire) != MAGIC || header->version != VERSION) {
+                std::cerr << "공유 메모리 링 형식이 맞지 않습니다: " << name << std::endl;
+                header = nullptr;
+                return false;
+            }
+
+            // 연결 시점의 최신 프레임부터 읽기 시작
+            nextSequence = latestSequence();
+            if (nextSequence == 0) {
+                nextSequence = 1;
+            }
+            return true;
+        }
+
+        const RingHeader* Reader::getHeader() const {
+            return header;
+        }
+
+        const uint8_t* Reader::slotAt(uint64_t seq) const {
+            return static_cast<const uint8_t*>(mapping) + header->slotsOffset + (seq % header->slotCount) * header->slotStride;
+        }
+
+        uint64_t Reader::latestSequence() const {
+            return header ? header->writeSequence.load(std::memory_order_acquire) : 0;
+        }
+
+        bool Reader::acquire(uint64_t sequence, FrameView& view) const {
+            if (!header || sequence == 0) return false;
+
+            const uint8_t* base = slotAt(sequence);
+            const SlotHeader* slot = reinterpret_cast<const SlotHeader*>(base);
+            if (slot->sequence.load(std::memory_order_acquire) != 2 * sequence) {
+                return false; // 기록 중이거나 이미 다른 프레임으로 덮어쓰임
+            }
+
+            view.sequence = sequence;
+            view.slot = slot;
+            view.color = base + header->colorOffset;
+            view.depth = reinterpret_cast<const uint16_t*>(base + header->depthOffset);
+            view.keypoints2d = reinterpret_cast<const KeypointProtocol::Point2D*>(base + header->keypoints2dOffset);
+            view.keypoints3d = (slot->flags & KeypointProtocol::FLAG_HAS_3D)
+                ? reinterpret_cast<const KeypointProtocol::Point3D*>(base + header->keypoints3dOffset)
+                : nullptr;
+            return true;
+        }
+
+        bool Reader::acquireNext(FrameView& view) {
+            uint64_t latest = latestSequence();
+            if (latest < nextSequence) {
+                return false; // 새 프레임 없음
+            }
+
+            // 링 용량보다 뒤처졌으면 남아 있는 가장 오래된 프레임으로 이동
+            uint64_t oldest = latest >= header->slotCount ? latest - header->slotCount + 1 : 1;
+            if (nextSequence < oldest) {
+                overrunCount += oldest - nextSequence;
+                nextSequence = oldest;
+            }
+
+            while (nextSequence <= latest) {
+                if (acquire(nextSequence++, view)) {
+                    return true;
+                }
+                overrunCount++; // 읽는 도중 덮어쓰임
+            }
+            return false;
+        }
+
+        bool Reader::acquireLatest(FrameView& view) {
+            uint64_t latest = latestSequence();
+            if (latest < nextSequence) {
+                return false;
+            }
+            overrunCount += latest - nextSequence; // 건너뛴 프레임
+            nextSequence = latest + 1;
+            return acquire(latest, view);
+        }
+
+        bool Reader::validate(const FrameView& view) const {
+            // 뷰 데이터 읽기가 시퀀스 재확인보다 먼저 완료되도록 보장
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return view.slot->sequence.load(std::memory_order_relaxed) == 2 * view.sequence;
+        }
+
+        uint64_t Reader::getOverrunCount() const {
+            return overrunCount;
+        }
+    } // namespace SharedFrameRing
+} // namespace Utils
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include "KeypointProtocol.h"
+
+namespace Utils {
+    // POSIX 공유 메모리 기반 단일 생산자 / 다중 소비자 프레임 링
+    // - 생산자(메인 루프)는 원본 컬러/깊이 프레임과 키포인트, 타임스탬프를 슬롯에 기록
+    // - 소비자는 복사 없이 슬롯 메모리를 직접 참조하고, 시퀀스 번호로 덮어쓰기(오버런)를 감지
+    // - 슬롯 시퀀스는 seqlock 방식: 2n-1 = 프레임 n 기록 중, 2n = 프레임 n 기록 완료
+    namespace SharedFrameRing {
+        const uint32_t MAGIC = 0x52535052; // "RPSR"
+        const uint32_t VERSION = 1;
+
+        static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "공유 메모리 링은 lock-free 64비트 원자 연산이 필요합니다");
+
+        // 링 전체 헤더 (공유 메모리 시작 위치)
+        struct RingHeader {
+            std::atomic<uint32_t> magic; // 초기화 완료 후 마지막에 기록
+            uint32_t version;
+            uint32_t slotCount;
+            uint32_t reserved;
+            uint64_t slotStride;       // 슬롯 간 바이트 간격
+            uint64_t slotsOffset;      // 첫 슬롯의 시작 오프셋
+
+            // 슬롯 내부 오프셋
+            uint32_t keypoints2dOffset;
+            uint32_t keypoints3dOffset;
+            uint32_t colorOffset;
+            uint32_t depthOffset;
+
+            // 프레임 형식
+            uint32_t colorWidth;
+            uint32_t colorHeight;
+            uint32_t colorBytesPerPixel;
+            uint32_t depthWidth;
+            uint32_t depthHeight;
+            float depthScale;          // Z16 값 * depthScale = 미터
+            uint32_t maxPersons;
+            uint32_t maxKeypoints;
+
+            alignas(64) std::atomic<uint64_t> writeSequence; // 마지막으로 완료된 프레임 시퀀스 (1부터)
+        };
+
+        // 슬롯 메타데이터 (각 슬롯 시작 위치)
+        struct SlotHeader {
+            std::atomic<uint64_t> sequence;
+            uint64_t frameNumber;
+            double sensorTimestampMs;  // RealSense 프레임 타임스탬프
+            int64_t publishTimeUs;     // 발행 시각 (system_clock, 마이크로초)
+            uint32_t numPersons;
+            uint32_t numKeypoints;
+            uint32_t flags;            // KeypointProtocol::FLAG_HAS_3D
+            uint32_t reserved;
+        };
+
+        // 생산자가 기록할 프레임 (모든 포인터는 발행 호출 동안만 유효하면 됨)
+        struct Frame {
+            uint64_t frameNumber;
+            double sensorTimestampMs;
+
+            const uint8_t* color;
+            int colorWidth;            // 링 생성 크기와 같아야 함
+            int colorHeight;
+            size_t colorStride;        // 행 간 바이트 수
+
+            const uint16_t* depth;     // 원본 Z16
+            int depthWidth;            // 링 생성 크기와 같아야 함 (데시메이션 등으로 축소된 프레임은 거부)
+            int depthHeight;
+            size_t depthStride;        // 행 간 바이트 수
+
+            const KeypointProtocol::Point2D* keypoints2d; // [numPersons * numKeypoints]
+            const KeypointProtocol::Point3D* keypoints3d; // nullptr 허용
+            int numPersons;
+            int numKeypoints;
+        };
+
+        // 소비자가 얻는 슬롯 뷰 (공유 메모리를 직접 가리킴, 복사 없음)
+        struct FrameView {
+            uint64_t sequence;
+            const SlotHeader* slot;
+            const uint8_t* color;
+            const uint16_t* depth;
+            const KeypointProtocol::Point2D* keypoints2d;
+            const KeypointProtocol::Point3D* keypoints3d;
+        };
+
+        // 생산자
+        class Writer {
+        public:
+            Writer(const std::string& name, int slotCount);
+            ~Writer();
+
+            // 공유 메모리 생성 및 링 레이아웃 초기화
+            bool create(int colorWidth, int colorHeight, int colorBytesPerPixel,
+                        int depthWidth, int depthHeight, float depthScale,
+                        int maxPersons, int maxKeypoints);
+
+            bool isCreated() const;
+
+            // 프레임 발행 (블록되지 않음 - 가장 오래된 슬롯을 덮어씀)
+            // 컬러/깊이 크기가 링 생성 크기와 다르면 슬롯을 건드리지 않고 false
+            bool publish(const Frame& frame);
+
+            uint64_t getWriteSequence() const;
+
+        private:
+            std::string name;
+            int slotCount;
+            int fd;
+            void* mapping;
+            size_t mappingSize;
+            RingHeader* header;
+            uint64_t sequence;
+
+            uint8_t* slotAt(uint64_t seq) const;
+        };
+
+        // 소비자
+        class Reader {
+        public:
+            Reader(const std::string& name);
+            ~Reader();
+
+            // 기존 링에 연결 (읽기 전용 매핑)
+            bool attach();
+
+            const RingHeader* getHeader() const;
+
+            // 마지막으로 완료된 프레임 시퀀스 (없으면 0)
+            uint64_t latestSequence() const;
+
+            // 지정 시퀀스의 슬롯 뷰 획득 (아직 없거나 이미 덮어쓰였으면 false)
+            bool acquire(uint64_t sequence, FrameView& view) const;
+
+            // 순차 읽기: 다음 프레임 뷰 획득, 뒤처진 경우 건너뛴 프레임을 오버런으로 집계
+            bool acquireNext(FrameView& view);
+
+            // 최신 프레임 뷰 획득 (저지연 소비자용)
+            bool acquireLatest(FrameView& view);
+
+            // 뷰 사용 후 호출 - 그 사이 생산자가 슬롯을 덮어썼으면 false (데이터 폐기 필요)
+            bool validate(const FrameView& view) const;
+
+            uint64_t getOverrunCount() const;
+
+        private:
+            std::string name;
+            int fd;
+            void* mapping;
+            size_t mappingSize;
+            const RingHeader* header;
+            uint64_t nextSequence;
+            uint64_t overrunCount;
+
+            const uint8_t* slotAt(uint64_t seq) const;
+        };
+    } // namespace SharedFrameRing
+} // namespace Utils
@@ -0,0 +1,150 @@
+#include "ThreadAffinity.h"
+#include <iostream>
+#include <sstream>
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+namespace Utils {
+    namespace ThreadAffinity {
+
+        bool parseCpuList(const std::string& text, std::vector<int>& cpus) {
+            cpus.clear();
+            std::stringstream ss(text);
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                if (item.empty()) continue;
+                char* end = nullptr;
+                long first = std::strtol(item.c_str(), &end, 10);
+                if (end == item.c_str() || first < 0) return false;
+                long last = first;
+                if (*end == '-') {
+                    const char* rangeStart = end + 1;
+                    last = std::strtol(rangeStart, &end, 10);
+                    if (end == rangeStart || last < first) return false;
+                }
+                if (*end != '\0' || last >= CPU_SETSIZE) return false;
+                for (long cpu = first; cpu <= last; cpu++) {
+                    cpus.push_back(static_cast<int>(cpu));
+                }
+            }
+            return true;
+        }
+
+        bool applyToCurrentThread(const std::string& role, const std::string& cpus, int priority) {
+            bool ok = true;
+
+            // 스레드 이름 (top/perf에서 구분, 15자 제한)
+            pthread_setname_np(pthread_self(), role.substr(0, 15).c_str());
+
+            if (!cpus.empty()) {
+                std::vector<int> cpuList;
+                if (!parseCpuList(cpus, cpuList) || cpuList.empty()) {
+                    std::cerr << "[스레드] " << role << ": 잘못된 CPU 목록 '" << cpus << "'" << std::endl;
+                    ok = false;
+                } else {
+                    cpu_set_t set;
+                    CPU_ZERO(&set);
+                    for (int cpu : cpuList) {
+                        CPU_SET(cpu, &set);
+                    }
+                    int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+                    if (error != 0) {
+                        std::cerr << "[스레드] " << role << ": CPU 고정 실패 (" << std::strerror(error) << ")" << std::endl;
+                        ok = false;
+                    }
+                }
+            }
+
+            if (priority > 0) {
+                sched_param param;
+                std::memset(&param, 0, sizeof(param));
+                param.sched_priority = priority;
+                int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+                if (error != 0) {
+                    // EPERM: CAP_SYS_NICE 또는 RLIMIT_RTPRIO 없음 - 기본 스케줄링으로 계속
+                    std::cerr << "[스레드] " << role << ": SCHED_FIFO " << priority << " 적용 실패 ("
+                              << std::strerror(error) << "), 기본 스케줄링 사용" << std::endl;
+                    ok = false;
+                }
+            }
+
+            std::cout << "[스레드] " << role << ": " << describeCurrentThread() << std::endl;
+            return ok;
+        }
+
+        bool resetCurrentThread(const std::string& role) {
+            bool ok = true;
+            pthread_setname_np(pthread_self(), role.substr(0, 15).c_str());
+
+            // 전체 CPU 집합 (커널이 실제 허용된 CPU로 제한)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                CPU_SET(cpu, &set);
+            }
+            int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+            if (error != 0) {
+                std::cerr << "[스레드] " << role << ": CPU 고정 해제 실패 (" << std::strerror(error) << ")" << std::endl;
+                ok = false;
+            }
+
+            // 실시간 우선순위를 낮추는 것은 권한 없이 가능
+            sched_param param;
+            std::memset(&param, 0, sizeof(param));
+            error = pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+            if (error != 0) {
+                std::cerr << "[스레드] " << role << ": 기본 스케줄링 복원 실패 (" << std::strerror(error) << ")" << std::endl;
+                ok = false;
+            }
+            return ok;
+        }
+
+        bool lockMemory() {
+            if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+                std::cerr << "[스레드] mlockall 실패 (" << std::strerror(errno) << "), 메모리 고정 없이 계속합니다." << std::endl;
+                return false;
+            }
+            std::cout << "[스레드] 프로세스 메모리 고정 (mlockall)" << std::endl;
+            return true;
+        }
+
+        std::string describeCurrentThread() {
+            std::stringstream ss;
+
+            // CPU 집합을 "0-3,6" 형식으로 축약
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+                ss << "CPU ";
+                bool first = true;
+                for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                    if (!CPU_ISSET(cpu, &set)) continue;
+                    int last = cpu;
+                    while (last + 1 < CPU_SETSIZE && CPU_ISSET(last + 1, &set)) last++;
+                    ss << (first ? "" : ",") << cpu;
+                    if (last > cpu) ss << "-" << last;
+                    first = false;
+                    cpu = last;
+                }
+            }
+
+            int policy = 0;
+            sched_param param;
+            if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+                if (policy == SCHED_FIFO) {
+                    ss << ", SCHED_FIFO " << param.sched_priority;
+                } else if (policy == SCHED_RR) {
+                    ss << ", SCHED_RR " << param.sched_priority;
+                } else {
+                    ss << ", SCHED_OTHER";
+                }
+            }
+            return ss.str();
+        }
+
+    } // namespace ThreadAffinity
+} // namespace Utils
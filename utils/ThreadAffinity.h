@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Utils {
+    // 스레드별 CPU 고정 및 실시간 스케줄링 (Linux 전용, 권한이 없으면 경고 후 기본 스케줄링 유지)
+    // - big.LITTLE/다중 소켓 장비에서 처리 스레드가 코어 사이를 옮겨 다니며 생기는 프레임 시간 튐 방지
+    namespace ThreadAffinity {
+
+        // "0-3,6" 형식의 CPU 목록 파싱 (빈 문자열은 빈 목록, 형식 오류면 false)
+        bool parseCpuList(const std::string& text, std::vector<int>& cpus);
+
+        // 현재 스레드에 이름, CPU 집합, SCHED_FIFO 우선순위 적용 후 결과 출력
+        // - cpus가 비어 있으면 CPU 고정 안 함, priority가 0이면 기본 스케줄링 유지
+        // - 하나라도 적용에 실패하면 false (나머지 항목은 계속 적용)
+        bool applyToCurrentThread(const std::string& role, const std::string& cpus, int priority);
+
+        // 현재 스레드를 CPU 제한 없음, SCHED_OTHER로 되돌림 (고정된 스레드가 만든 보조 스레드용 - 설정을 상속하지 않도록)
+        // - 하나라도 적용에 실패하면 false
+        bool resetCurrentThread(const std::string& role);
+
+        // 현재/이후 할당 메모리를 모두 고정 (페이지 폴트로 인한 지연 방지)
+        bool lockMemory();
+
+        // 현재 스레드의 실제 CPU 집합과 스케줄링 정책 설명 (예: "CPU 4-5, SCHED_FIFO 50")
+        std::string describeCurrentThread();
+
+    } // namespace ThreadAffinity
+} // namespace Utils
@@ -0,0 +1,99 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace Utils {
+    ThreadPool::ThreadPool(int threadCount, const std::function<void()>& threadInit)
+        : threadInit(threadInit), task(nullptr), taskCount(0), generation(0), pending(0), stopping(false) {
+        // 호출 스레드가 구간 0을 맡으므로 작업자는 threadCount - 1개
+        for (int i = 1; i < threadCount; i++) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        startCondition.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    int ThreadPool::getThreadCount() const {
+        return static_cast<int>(workers.size()) + 1;
+    }
+
+    namespace {
+        // 구간 index의 [begin, end) 계산 (앞쪽 구간이 나머지를 하나씩 더 가짐)
+        void chunkRange(int count, int chunks, int index, int& begin, int& end) {
+            int base = count / chunks;
+            int extra = count % chunks;
+            begin = index * base + std::min(index, extra);
+            end = begin + base + (index < extra ? 1 : 0);
+        }
+    }
+
+    void ThreadPool::parallelFor(int count, const std::function<void(int, int)>& fn) {
+        if (count <= 0) return;
+
+        int chunks = std::min(getThreadCount(), count);
+        if (chunks == 1) {
+            fn(0, count);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = &fn;
+            taskCount = count;
+            pending = static_cast<int>(workers.size());
+            generation++;
+        }
+        startCondition.notify_all();
+
+        // 호출 스레드는 구간 0 처리
+        int begin, end;
+        chunkRange(count, chunks, 0, begin, end);
+        fn(begin, end);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCondition.wait(lock, [this] { return pending == 0; });
+        task = nullptr;
+    }
+
+    void ThreadPool::workerLoop(int workerIndex) {
+        if (threadInit) {
+            threadInit();
+        }
+
+        uint64_t seenGeneration = 0;
+        while (true) {
+            const std::function<void(int, int)>* currentTask;
+            int count;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                startCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                if (stopping) return;
+                seenGeneration = generation;
+                currentTask = task;
+                count = taskCount;
+            }
+
+            // 작업 수가 스레드 수보다 적으면 빈 구간은 건너뜀
+            int chunks = std::min(getThreadCount(), count);
+            if (workerIndex < chunks) {
+                int begin, end;
+                chunkRange(count, chunks, workerIndex, begin, end);
+                (*currentTask)(begin, end);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending--;
+            }
+            doneCondition.notify_one();
+        }
+    }
+}
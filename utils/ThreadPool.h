@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+
+namespace Utils {
+    // 고정 크기 작업자 스레드 풀 - 프레임마다 스레드를 만들지 않고 범위 작업을 나누어 실행
+    // - parallelFor 호출 스레드도 한 구간을 직접 처리하므로 threadCount 1이면 스레드 없이 순차 실행
+    class ThreadPool {
+    public:
+        // threadInit: 각 작업자 스레드 시작 시 한 번 호출 (CPU 고정 등)
+        explicit ThreadPool(int threadCount, const std::function<void()>& threadInit = std::function<void()>());
+        ~ThreadPool();
+
+        // 호출 스레드를 포함한 병렬 실행 수
+        int getThreadCount() const;
+
+        // [0, count) 범위를 스레드 수만큼 나누어 fn(begin, end)를 실행, 모두 끝날 때까지 대기
+        void parallelFor(int count, const std::function<void(int, int)>& fn);
+
+    private:
+        void workerLoop(int workerIndex);
+
+        std::function<void()> threadInit;
+
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable startCondition;
+        std::condition_variable doneCondition;
+
+        const std::function<void(int, int)>* task;
+        int taskCount;
+        uint64_t generation; // 새 작업마다 증가 - 작업자가 같은 작업을 두 번 처리하지 않도록
+        int pending;
+        bool stopping;
+    };
+}
@@ -0,0 +1,247 @@
+#include "VideoRecorder.h"
+#include <iostream>
+#include <cstdio>
+#include "ColorConversion.h"
+#include "FileUtils.h"
+#include "Visualizer.h"
+#include "../DepthProcessor.h"
+
+namespace Utils {
+    namespace {
+        int64_t nowUs() {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // AVI 컨테이너를 쓰는 코덱 (나머지는 MP4)
+        bool usesAvi(const std::string& codec) {
+            return codec == "MJPG" || codec == "XVID" || codec == "DIVX";
+        }
+    }
+
+    VideoRecorder::VideoRecorder(const AppConfig& config, const std::string& name)
+        : config(config), liveConfig(std::make_shared<const AppConfig>(config)), name(name), fourcc(-1),
+          frameIntervalUs(config.record.fps > 0 ? static_cast<int64_t>(1000000.0 / config.record.fps) : 0),
+          nextFrameUs(0), readIndex(0), writeIndex(0), count(0), stopping(false), running(false),
+          failed(false), writtenCount(0), droppedCount(0), segmentIndex(0), segmentFrames(0) {
+        const std::string& codec = config.record.codec;
+        if (codec.size() == 4) {
+            fourcc = cv::VideoWriter::fourcc(codec[0], codec[1], codec[2], codec[3]);
+        }
+        extension = usesAvi(codec) ? ".avi" : ".mp4";
+        jobs.resize(config.record.queue_size > 0 ? config.record.queue_size : 1);
+    }
+
+    VideoRecorder::~VideoRecorder() {
+        stop();
+    }
+
+    bool VideoRecorder::start() {
+        if (running) return true;
+        if (fourcc < 0) {
+            std::cerr << "녹화 코덱은 4글자 FourCC여야 합니다: " << config.record.codec << std::endl;
+            return false;
+        }
+        if (!FileUtils::createDirectory(config.record.directory)) {
+            std::cerr << "녹화 디렉토리 생성 실패: " << config.record.directory << std::endl;
+            return false;
+        }
+        sessionTimestamp = FileUtils::currentTimestamp();
+        stopping = false;
+        running = true;
+        thread = std::thread(&VideoRecorder::run, this);
+        std::cout << "녹화 시작: " << config.record.directory << "/" << sessionTimestamp
+                  << (name.empty() ? "" : "_" + name) << "_*" << extension << std::endl;
+        return true;
+    }
+
+    void VideoRecorder::stop() {
+        if (!running) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_one();
+        thread.join();
+        running = false;
+        std::cout << "녹화 종료: " << writtenCount.load() << "프레임 기록, " << droppedCount.load() << "프레임 드롭" << std::endl;
+    }
+
+    bool VideoRecorder::wantsFrame() {
+        if (!running || failed.load(std::memory_order_relaxed)) return false;
+        int64_t now = nowUs();
+        if (now < nextFrameUs) return false;
+
+        // 일정한 간격 유지 (한 간격 넘게 밀렸으면 현재 시각 기준으로 다시 맞춤)
+        if (now - nextFrameUs > frameIntervalUs) {
+            nextFrameUs = now + frameIntervalUs;
+        } else {
+            nextFrameUs += frameIntervalUs;
+        }
+        return true;
+    }
+
+    bool VideoRecorder::submit(const cv::Mat& color, const rs2::depth_frame& depthFrame, const PoseResult& result,
+                               const FPSCounter::Stats& stats, float centerDist, const FrameTiming::Breakdown* latency) {
+        if (!running || failed.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (count == jobs.size()) {
+                droppedCount++;
+                return false;
+            }
+        }
+
+        // 빈 슬롯은 인코더가 읽지 않으므로 잠금 없이 복사 (카메라 프레임은 바로 반환 가능)
+        Job& job = jobs[writeIndex];
+        color.copyTo(job.color);
+        if (config.record.depth && depthFrame) {
+            cv::Mat depthRaw(depthFrame.get_height(), depthFrame.get_width(), CV_16UC1,
+                             const_cast<void*>(depthFrame.get_data()), depthFrame.get_stride_in_bytes());
+            depthRaw.copyTo(job.depth);
+            job.depthUnits = depthFrame.get_units();
+        } else {
+            job.depth.release();
+        }
+        job.result = result;
+        job.stats = stats;
+        job.centerDist = centerDist;
+        job.visualization = liveConfig;
+        job.hasLatency = latency != nullptr;
+        if (latency) {
+            job.latency = *latency;
+        }
+        writeIndex = (writeIndex + 1) % jobs.size();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            count++;
+        }
+        condition.notify_one();
+        return true;
+    }
+
+    void VideoRecorder::applyConfig(const std::shared_ptr<const AppConfig>& config) {
+        liveConfig = config;
+    }
+
+    uint64_t VideoRecorder::getWrittenCount() const {
+        return writtenCount.load();
+    }
+
+    uint64_t VideoRecorder::getDroppedCount() const {
+        return droppedCount.load();
+    }
+
+    void VideoRecorder::run() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this] { return stopping || count > 0; });
+                // 종료 요청 후에도 큐에 남은 프레임은 모두 기록
+                if (count == 0) break;
+            }
+
+            encode(jobs[readIndex]);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                readIndex = (readIndex + 1) % jobs.size();
+                count--;
+            }
+        }
+        closeSegment();
+    }
+
+    void VideoRecorder::encode(Job& job) {
+        if (failed.load(std::memory_order_relaxed)) return;
+
+        // 오버레이는 슬롯 버퍼(복사본)에 직접 그림
+        cv::Mat poseImage = ColorConversion::toBgr(job.color);
+        Visualizer::drawOverlay(poseImage, job.result, job.stats, job.centerDist, job.hasLatency ? &job.latency : nullptr);
+
+        cv::Mat depthImage;
+        if (!job.depth.empty()) {
+            depthImage = DepthProcessor::enhancedDepthVisualization(job.depth, job.depthUnits, *job.visualization);
+        }
+
+        if (needsRotation(poseImage.size(), depthImage.size())) {
+            closeSegment();
+            if (!openSegment(poseImage.size(), depthImage.size())) {
+                failed = true;
+                return;
+            }
+        }
+
+        pose.writer.write(poseImage);
+        if (!depthImage.empty()) {
+            depth.writer.write(depthImage);
+        }
+        segmentFrames++;
+        writtenCount++;
+    }
+
+    bool VideoRecorder::needsRotation(const cv::Size& poseSize, const cv::Size& depthSize) {
+        if (!pose.writer.isOpened()) return true;
+
+        // 해상도가 바뀌면 (품질 조절 데시메이션 등) 같은 파일에 이어 쓸 수 없음
+        if (poseSize != pose.size || depthSize != depth.size) return true;
+
+        if (config.record.segment_seconds > 0 &&
+            std::chrono::steady_clock::now() - segmentStart >= std::chrono::seconds(config.record.segment_seconds)) {
+            return true;
+        }
+
+        // 파일 크기는 약 1초 분량마다 확인 (매 프레임 stat 호출 방지)
+        uint64_t checkInterval = config.record.fps > 1.0 ? static_cast<uint64_t>(config.record.fps) : 1;
+        if (config.record.segment_mb > 0 && segmentFrames % checkInterval == 0) {
+            long long bytes = FileUtils::fileSize(pose.path);
+            if (depth.writer.isOpened()) {
+                bytes += FileUtils::fileSize(depth.path);
+            }
+            if (bytes >= static_cast<long long>(config.record.segment_mb) * 1024 * 1024) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool VideoRecorder::openSegment(const cv::Size& poseSize, const cv::Size& depthSize) {
+        segmentIndex++;
+        if (!openStream(pose, "pose", poseSize)) {
+            return false;
+        }
+        if (depthSize.area() > 0 && !openStream(depth, "depth", depthSize)) {
+            pose.writer.release();
+            return false;
+        }
+        depth.size = depthSize;
+        segmentStart = std::chrono::steady_clock::now();
+        segmentFrames = 0;
+        return true;
+    }
+
+    bool VideoRecorder::openStream(Stream& stream, const std::string& suffix, const cv::Size& size) {
+        // <디렉토리>/<시작 시각>[_<이름>]_<세그먼트 번호>_<pose|depth>.<확장자>
+        char segment[16];
+        std::snprintf(segment, sizeof(segment), "%03d", segmentIndex);
+        stream.path = config.record.directory + "/" + sessionTimestamp + (name.empty() ? "" : "_" + name) +
+                      "_" + segment + "_" + suffix + extension;
+        stream.size = size;
+
+        if (!stream.writer.open(stream.path, fourcc, config.record.fps, size, true)) {
+            std::cerr << "녹화 파일을 열 수 없습니다: " << stream.path << " (코덱 " << config.record.codec << ")" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    void VideoRecorder::closeSegment() {
+        pose.writer.release();
+        depth.writer.release();
+        pose.size = cv::Size();
+        depth.size = cv::Size();
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <librealsense2/rs.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../ConfigManager.h"
+#include "../PoseResult.h"
+#include "FPSCounter.h"
+#include "FrameTiming.h"
+
+namespace Utils {
+    // 오버레이가 그려진 포즈 뷰와 깊이 컬러맵을 cv::VideoWriter로 녹화 (전용 인코더 스레드)
+    // - 처리 루프는 원본 컬러/Z16 깊이와 포즈 결과를 빈 큐 슬롯에 복사만 하고, 오버레이/컬러맵/인코딩은 인코더 스레드가 수행
+    // - 큐(record.queue_size)가 가득 차면 그 프레임은 버리고 드롭 카운트만 증가 - 캡처/추론 경로는 절대 기다리지 않음
+    // - record.fps 간격으로만 프레임을 받고, 세그먼트 길이(초) 또는 크기(MB)를 넘거나 해상도가 바뀌면 새 파일로 교체
+    class VideoRecorder {
+    public:
+        // name: 파일 이름에 붙일 구분자 (다중 카메라의 카메라 번호 등, 비어 있으면 생략)
+        VideoRecorder(const AppConfig& config, const std::string& name = "");
+        ~VideoRecorder();
+
+        // 출력 디렉토리 생성 및 인코더 스레드 시작
+        bool start();
+
+        // 큐에 남은 프레임을 모두 기록한 뒤 파일을 닫고 종료
+        void stop();
+
+        // 녹화 간격상 이번 프레임을 제출할 차례인지 (처리 스레드 전용, 호출 시 다음 녹화 시각으로 진행)
+        bool wantsFrame();
+
+        // 프레임 제출 - 큐가 가득 찼거나 인코더가 실패한 상태면 false (드롭 카운트 증가)
+        bool submit(const cv::Mat& color, const rs2::depth_frame& depthFrame, const PoseResult& result,
+                    const FPSCounter::Stats& stats, float centerDist, const FrameTiming::Breakdown* latency);
+
+        // 핫 리로드된 설정 반영 (처리 스레드 전용) - 이후 제출한 프레임의 깊이 컬러맵에 깊이 범위/CLAHE 적용
+        // (record.* 항목은 녹화 시작 값 유지)
+        void applyConfig(const std::shared_ptr<const AppConfig>& config);
+
+        // 기록/드롭 통계
+        uint64_t getWrittenCount() const;
+        uint64_t getDroppedCount() const;
+
+    private:
+        // 큐 슬롯 (버퍼는 슬롯별로 재사용)
+        struct Job {
+            cv::Mat color;       // BGR 또는 YUYV 원본
+            cv::Mat depth;       // 원시 Z16 (깊이 녹화 시에만)
+            float depthUnits;
+            PoseResult result;
+            FPSCounter::Stats stats;
+            float centerDist;
+            FrameTiming::Breakdown latency;
+            bool hasLatency;
+            std::shared_ptr<const AppConfig> visualization; // 제출 시점의 설정 스냅샷 (깊이 컬러맵용)
+        };
+
+        // 세그먼트 파일 하나
+        struct Stream {
+            cv::VideoWriter writer;
+            std::string path;
+            cv::Size size;
+        };
+
+        void run();
+        void encode(Job& job);
+
+        // 세그먼트 교체가 필요한지 (길이/크기/해상도)
+        bool needsRotation(const cv::Size& poseSize, const cv::Size& depthSize);
+        bool openSegment(const cv::Size& poseSize, const cv::Size& depthSize);
+        bool openStream(Stream& stream, const std::string& suffix, const cv::Size& size);
+        void closeSegment();
+
+        const AppConfig& config;
+        std::shared_ptr<const AppConfig> liveConfig; // 처리 스레드 전용, 제출하는 슬롯에 복사
+        std::string name;
+        int fourcc;
+        std::string extension;
+        int64_t frameIntervalUs;
+        int64_t nextFrameUs;
+
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::vector<Job> jobs; // 고정 크기 링 큐 (writeIndex 슬롯은 처리 스레드가 잠금 밖에서 채움)
+        size_t readIndex;
+        size_t writeIndex;
+        size_t count;
+        bool stopping;
+        bool running;
+        std::atomic<bool> failed; // 파일을 열거나 쓰지 못하면 이후 제출 거부
+
+        std::atomic<uint64_t> writtenCount;
+        std::atomic<uint64_t> droppedCount;
+
+        // 인코더 스레드 전용
+        std::string sessionTimestamp;
+        Stream pose;
+        Stream depth;
+        int segmentIndex;
+        std::chrono::steady_clock::time_point segmentStart;
+        uint64_t segmentFrames;
+    };
+}
@@ -5,51 +5,50 @@
 namespace Utils {
     namespace Visualizer {
 
-        const std::string POSE_WINDOW_NAME = "Pose Estimation";
-        const std::string DEPTH_WINDOW_NAME = "Enhanced Depth";
-
-        void initializeWindows() {
-            cv::namedWindow(POSE_WINDOW_NAME, cv::WINDOW_AUTOSIZE);
-            cv::namedWindow(DEPTH_WINDOW_NAME, cv::WINDOW_AUTOSIZE);
-        }
-
-        void drawResults(
-            cv::Mat& poseImage, // 입력 이미지를 직접 수정 (colorImage.clone() 대신 원본 사용 가정)
-            const cv::Mat& enhancedDepth,
-            const std::vector<std::vector<cv::Point>>& keypoints,
-            float fps,
+        void drawOverlay(
+            cv::Mat& poseImage,
+            const PoseResult& keypoints,
+            const FPSCounter::Stats& frameStats,
             float centerDist,
-            const AppConfig& config // config는 현재 직접 사용되지 않지만, 향후 확장을 위해 남겨둠
+            const FrameTiming::Breakdown* latency
         ) {
             // 포즈 추정 결과 시각화 (PoseEstimator의 static 함수 호출)
-            if (!keypoints.empty()) {
-                PoseEstimator::drawKeypoints(poseImage, keypoints);
-            }
+            PoseEstimator::drawKeypoints(poseImage, keypoints);
             
             // 중앙에 십자선 그리기 (DepthProcessor의 static 함수 호출)
             DepthProcessor::drawCrosshair(poseImage, 5, cv::Scalar(0, 255, 0));
             
             // FPS 정보 추가
             std::stringstream fpsSs;
-            fpsSs << "FPS: " << std::fixed << std::setprecision(1) << fps;
+            fpsSs << "FPS: " << std::fixed << std::setprecision(1) << frameStats.fps;
             cv::putText(poseImage, fpsSs.str(), cv::Point(10, 20), cv::FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(0, 255, 0), 1);
             
+            // 프레임 시간 꼬리 지연 정보 추가 (평균만으로는 드러나지 않는 정지 확인)
+            std::stringstream tailSs;
+            tailSs << "Frame p50/p99/max: " << std::fixed << std::setprecision(1)
+                   << frameStats.p50Ms << "/" << frameStats.p99Ms << "/" << frameStats.maxMs << "ms";
+            cv::putText(poseImage, tailSs.str(), cv::Point(10, 40), cv::FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(0, 255, 0), 1);
+            
             // 거리 정보 추가
             std::stringstream distSs;
             distSs << "Distance: " << std::fixed << std::setprecision(2) << centerDist << "m";
-            cv::putText(poseImage, distSs.str(), cv::Point(10, 40), cv::FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(0, 255, 0), 1);
+            cv::putText(poseImage, distSs.str(), cv::Point(10, 60), cv::FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(0, 255, 0), 1);
+            
+            // 센서→결과 지연 정보 추가 (USB/큐 대기 구간과 처리 구간 분리)
+            if (latency && latency->endToEndMs >= 0.0) {
+                std::stringstream latencySs;
+                latencySs << "E2E: " << std::fixed << std::setprecision(1) << latency->endToEndMs << "ms (";
+                if (latency->sensorToArrivalMs >= 0.0) {
+                    latencySs << "usb " << latency->sensorToArrivalMs << ", ";
+                }
+                latencySs << "queue " << latency->arrivalToAcquireMs
+                          << ", proc " << latency->depthMs + latency->poseMs + latency->renderMs << ")";
+                cv::putText(poseImage, latencySs.str(), cv::Point(10, 80), cv::FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(0, 255, 0), 1);
+            }
             
             // 컨트롤 정보 추가 - Pose Estimation에만 표시
             cv::putText(poseImage, "s: Save, q: Quit", cv::Point(10, poseImage.rows - 10), 
                        cv::FONT_HERSHEY_SIMPLEX, 0.4, cv::Scalar(0, 255, 0), 1);
-            
-            // Pose Estimation과 Enhanced Depth 창 표시
-            cv::imshow(POSE_WINDOW_NAME, poseImage);
-            cv::imshow(DEPTH_WINDOW_NAME, enhancedDepth);
-        }
-
-        void destroyWindows() {
-            cv::destroyAllWindows();
         }
 
     } // namespace Visualizer
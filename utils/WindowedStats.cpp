@@ -0,0 +1,96 @@
+#include "WindowedStats.h"
+#include <cmath>
+#include <algorithm>
+
+namespace Utils {
+    const int WindowedStats::NUM_BUCKETS;
+    constexpr float WindowedStats::MIN_SECONDS;
+    constexpr float WindowedStats::BUCKET_RATIO;
+
+    WindowedStats::WindowedStats(int windowSize)
+        : capacity(std::max(1, windowSize)),
+          samples(capacity, 0.0f),
+          bucketOf(capacity, 0),
+          maxValues(capacity, 0.0f),
+          maxIndices(capacity, 0) {
+        reset();
+    }
+
+    void WindowedStats::reset() {
+        head = 0;
+        count = 0;
+        sum = 0.0;
+        sampleIndex = 0;
+        maxHead = 0;
+        maxSize = 0;
+        std::fill(buckets, buckets + NUM_BUCKETS, 0);
+    }
+
+    int WindowedStats::bucketIndex(float seconds) {
+        if (seconds <= MIN_SECONDS) return 0;
+        int index = static_cast<int>(std::log(seconds / MIN_SECONDS) / std::log(BUCKET_RATIO)) + 1;
+        return std::min(index, NUM_BUCKETS - 1);
+    }
+
+    float WindowedStats::bucketUpperBound(int index) {
+        return MIN_SECONDS * std::pow(BUCKET_RATIO, static_cast<float>(index));
+    }
+
+    void WindowedStats::add(float seconds) {
+        // 윈도우가 가득 찼으면 가장 오래된 샘플 제거
+        if (count == capacity) {
+            sum -= samples[head];
+            buckets[bucketOf[head]]--;
+        } else {
+            count++;
+        }
+
+        int bucket = bucketIndex(seconds);
+        samples[head] = seconds;
+        bucketOf[head] = static_cast<uint8_t>(bucket);
+        buckets[bucket]++;
+        sum += seconds;
+        head = (head + 1) % capacity;
+
+        // 단조 큐: 윈도우를 벗어난 앞쪽 제거, 새 값보다 작은 뒤쪽 제거
+        uint64_t index = sampleIndex++;
+        if (maxSize > 0 && maxIndices[maxHead] + capacity <= index) {
+            maxHead = (maxHead + 1) % capacity;
+            maxSize--;
+        }
+        while (maxSize > 0 && maxValues[(maxHead + maxSize - 1) % capacity] <= seconds) {
+            maxSize--;
+        }
+        int tail = (maxHead + maxSize) % capacity;
+        maxValues[tail] = seconds;
+        maxIndices[tail] = index;
+        maxSize++;
+    }
+
+    float WindowedStats::mean() const {
+        return count > 0 ? static_cast<float>(sum / count) : 0.0f;
+    }
+
+    float WindowedStats::percentile(float q) const {
+        if (count == 0) return 0.0f;
+
+        // 누적 개수가 목표 순위에 도달하는 버킷의 상한 (단, 실제 최대값을 넘지 않음)
+        int target = std::max(1, static_cast<int>(std::ceil(q * count)));
+        int cumulative = 0;
+        for (int i = 0; i < NUM_BUCKETS; i++) {
+            cumulative += buckets[i];
+            if (cumulative >= target) {
+                return std::min(bucketUpperBound(i), max());
+            }
+        }
+        return max();
+    }
+
+    float WindowedStats::max() const {
+        return maxSize > 0 ? maxValues[maxHead] : 0.0f;
+    }
+
+    int WindowedStats::size() const {
+        return count;
+    }
+}
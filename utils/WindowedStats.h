@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Utils {
+    // 고정 크기 슬라이딩 윈도우 지연 통계
+    // - 링 버퍼 + 누적 합으로 평균 O(1)
+    // - 로그 간격 고정 히스토그램(윈도우 내 샘플만 유지)으로 p50/p99 등 백분위수 (버킷 수 고정 = 상수 시간)
+    // - 단조 큐로 윈도우 내 최대값(최대 정지 시간) O(1) 분할상환
+    // 파이프라인 어느 단계에서든 단계별 지연 추적기로 사용 가능 (샘플 단위: 초)
+    class WindowedStats {
+    public:
+        explicit WindowedStats(int windowSize = 30);
+
+        // 샘플 추가 (초)
+        void add(float seconds);
+
+        // 윈도우 통계 (초)
+        float mean() const;
+        float percentile(float q) const; // q: 0.0 ~ 1.0, 버킷 해상도(약 8%) 내 근사
+        float max() const;
+        int size() const;
+
+        void reset();
+
+    private:
+        // 히스토그램 범위: 0.1ms ~ 약 5s, 로그 간격
+        static const int NUM_BUCKETS = 72;
+        static constexpr float MIN_SECONDS = 0.0001f;
+        static constexpr float BUCKET_RATIO = 1.1622f;
+
+        int capacity;
+        std::vector<float> samples;     // 링 버퍼
+        std::vector<uint8_t> bucketOf;  // 각 샘플의 버킷 인덱스 (제거 시 사용)
+        int head;                       // 다음 기록 위치
+        int count;
+        double sum;
+        uint64_t sampleIndex;           // 지금까지 추가된 샘플 수
+
+        int buckets[NUM_BUCKETS];
+
+        // 최대값 추적용 단조 감소 큐 (링 배열로 구현, 할당 없음)
+        std::vector<float> maxValues;
+        std::vector<uint64_t> maxIndices;
+        int maxHead;
+        int maxSize;
+
+        static int bucketIndex(float seconds);
+        static float bucketUpperBound(int index);
+    };
+}